@@ -22,25 +22,42 @@
 #include <string>
 
 #include "agg_file.h"
+#include "tools.h"
 
 namespace fheroes2
 {
     bool AGGFile::open( const std::string & fileName )
     {
-        if ( !_stream.open( fileName, "rb" ) )
+        _files.clear();
+
+        if ( !_file.open( fileName ) )
+            return false;
+
+        const size_t size = _file.size();
+        const FileData countEntry = _file.read( 0, sizeof( uint16_t ) );
+        if ( countEntry.empty() )
             return false;
 
-        const size_t size = _stream.size();
-        const size_t count = _stream.getLE16();
+        const size_t count = StreamBuf( countEntry.data(), countEntry.size() ).getLE16();
         const size_t fileRecordSize = sizeof( uint32_t ) * 3;
 
         if ( count * ( fileRecordSize + _maxFilenameSize ) >= size )
             return false;
 
-        StreamBuf fileEntries = _stream.toStreamBuf( count * fileRecordSize );
         const size_t nameEntriesSize = _maxFilenameSize * count;
-        _stream.seek( size - nameEntriesSize );
-        StreamBuf nameEntries = _stream.toStreamBuf( nameEntriesSize );
+
+        const FileData fileEntriesData = _file.read( sizeof( uint16_t ), count * fileRecordSize );
+        const FileData nameEntriesData = _file.read( size - nameEntriesSize, nameEntriesSize );
+        if ( fileEntriesData.empty() || nameEntriesData.empty() )
+            return false;
+
+        _checksum = fheroes2::calculateCRC32( fileEntriesData.data(), fileEntriesData.size() )
+                    ^ fheroes2::calculateCRC32( nameEntriesData.data(), nameEntriesData.size() ) ^ static_cast<uint32_t>( size );
+
+        StreamBuf fileEntries( fileEntriesData.data(), fileEntriesData.size() );
+        StreamBuf nameEntries( nameEntriesData.data(), nameEntriesData.size() );
+
+        _files.reserve( count );
 
         for ( size_t i = 0; i < count; ++i ) {
             std::string name = nameEntries.toString( _maxFilenameSize );
@@ -53,21 +70,20 @@ namespace fheroes2
             _files.clear();
             return false;
         }
-        return !_stream.fail();
+        return true;
     }
 
-    std::vector<uint8_t> AGGFile::read( const std::string & fileName )
+    FileData AGGFile::read( const std::string & fileName ) const
     {
         auto it = _files.find( fileName );
         if ( it != _files.end() ) {
             const auto & fileParams = it->second;
             if ( fileParams.first > 0 ) {
-                _stream.seek( fileParams.second );
-                return _stream.getRaw( fileParams.first );
+                return _file.read( fileParams.second, fileParams.first );
             }
         }
 
-        return std::vector<uint8_t>();
+        return {};
     }
 }
 
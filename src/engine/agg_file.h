@@ -23,11 +23,12 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "mapped_file.h"
 #include "serialize.h"
 
 namespace fheroes2
@@ -42,17 +43,28 @@ namespace fheroes2
 
         bool isGood() const
         {
-            return !_stream.fail() && !_files.empty();
+            return _file.isOpen() && !_files.empty();
         }
 
         bool open( const std::string & fileName );
-        std::vector<uint8_t> read( const std::string & fileName );
+
+        // Returns data of the requested resource. The returned object refers directly to the memory mapped AGG file when possible
+        // so it must not outlive this object. This method is thread-safe.
+        FileData read( const std::string & fileName ) const;
+
+        // Returns CRC32 checksum of the file's table of contents. It changes whenever the content of the file is altered in a way
+        // which affects the position or the size of any resource.
+        uint32_t checksum() const
+        {
+            return _checksum;
+        }
 
     private:
         static const size_t _maxFilenameSize = 15; // 8.3 ASCIIZ file name + 2-bytes padding
 
-        StreamFile _stream;
-        std::map<std::string, std::pair<uint32_t, uint32_t>> _files;
+        MappedFile _file;
+        std::unordered_map<std::string, std::pair<uint32_t, uint32_t>> _files;
+        uint32_t _checksum{ 0 };
     };
 
     struct ICNHeader
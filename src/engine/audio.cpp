@@ -91,6 +91,144 @@ namespace
     // be acquired in any callback functions that can be called by SDL_Mixer.
     std::recursive_mutex audioMutex;
 
+    // Maximum amount of memory occupied by sound samples converted to the audio device format which are not being played at the moment.
+    const size_t maxSoundSampleCacheSize = 32 * 1024 * 1024;
+
+    // Sound samples converted to the audio device format are kept in this cache, so repeatedly played sounds are decoded and resampled only once.
+    // A sample cannot be freed while it is being played by any channel. All operations must be performed under the audioMutex.
+    class SoundSampleCache
+    {
+    public:
+        SoundSampleCache() = default;
+        SoundSampleCache( const SoundSampleCache & ) = delete;
+
+        ~SoundSampleCache()
+        {
+            // Make sure that all sound samples have been eventually freed
+            assert( _samples.empty() );
+        }
+
+        SoundSampleCache & operator=( const SoundSampleCache & ) = delete;
+
+        // Returns the sample with the given ID increasing its reference counter. If the sample is not in the cache yet it is created from the given WAV data.
+        Mix_Chunk * acquire( const int sampleId, const uint8_t * ptr, const uint32_t size )
+        {
+            auto iter = _samples.find( sampleId );
+            if ( iter == _samples.end() ) {
+                Mix_Chunk * chunk = loadSample( ptr, size );
+                if ( chunk == nullptr ) {
+                    return nullptr;
+                }
+
+                iter = _samples.try_emplace( sampleId ).first;
+                iter->second.chunk = chunk;
+
+                _chunkToSampleId.try_emplace( chunk, sampleId );
+                _totalSize += chunk->alen;
+            }
+
+            SampleInfo & info = iter->second;
+            ++info.refCount;
+            info.lastUseTime = ++_useCounter;
+
+            shrink();
+
+            return info.chunk;
+        }
+
+        // Decreases the reference counter of the sample. Returns false if the sample does not belong to the cache.
+        bool release( Mix_Chunk * chunk )
+        {
+            const auto chunkIter = _chunkToSampleId.find( chunk );
+            if ( chunkIter == _chunkToSampleId.end() ) {
+                return false;
+            }
+
+            const auto iter = _samples.find( chunkIter->second );
+            assert( iter != _samples.end() && iter->second.refCount > 0 );
+
+            --iter->second.refCount;
+
+            shrink();
+
+            return true;
+        }
+
+        void clear()
+        {
+            for ( const auto & [sampleId, info] : _samples ) {
+                // All channels must be stopped before clearing the cache.
+                assert( info.refCount == 0 );
+
+                Mix_FreeChunk( info.chunk );
+            }
+
+            _samples.clear();
+            _chunkToSampleId.clear();
+            _totalSize = 0;
+        }
+
+        static Mix_Chunk * loadSample( const uint8_t * ptr, const uint32_t size )
+        {
+            SDL_RWops * rwops = SDL_RWFromConstMem( ptr, size );
+            if ( rwops == nullptr ) {
+                ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << SDL_GetError() )
+                return nullptr;
+            }
+
+            Mix_Chunk * sample = Mix_LoadWAV_RW( rwops, 1 );
+            if ( sample == nullptr ) {
+                ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << Mix_GetError() )
+                return nullptr;
+            }
+
+            return sample;
+        }
+
+    private:
+        struct SampleInfo
+        {
+            Mix_Chunk * chunk{ nullptr };
+            int refCount{ 0 };
+            uint64_t lastUseTime{ 0 };
+        };
+
+        std::map<int, SampleInfo> _samples;
+        std::map<const Mix_Chunk *, int> _chunkToSampleId;
+
+        size_t _totalSize{ 0 };
+        uint64_t _useCounter{ 0 };
+
+        // Free the least recently used samples which are not being played until the cache fits into the memory limit.
+        void shrink()
+        {
+            while ( _totalSize > maxSoundSampleCacheSize ) {
+                auto oldestIter = _samples.end();
+
+                for ( auto iter = _samples.begin(); iter != _samples.end(); ++iter ) {
+                    if ( iter->second.refCount == 0 && ( oldestIter == _samples.end() || iter->second.lastUseTime < oldestIter->second.lastUseTime ) ) {
+                        oldestIter = iter;
+                    }
+                }
+
+                if ( oldestIter == _samples.end() ) {
+                    // All samples are being played at the moment.
+                    return;
+                }
+
+                Mix_Chunk * chunk = oldestIter->second.chunk;
+
+                _totalSize -= chunk->alen;
+                _chunkToSampleId.erase( chunk );
+                _samples.erase( oldestIter );
+
+                Mix_FreeChunk( chunk );
+            }
+        }
+    };
+
+    SoundSampleCache soundSampleCache;
+
     class SoundSampleManager
     {
     public:
@@ -165,7 +303,9 @@ namespace
                 auto & sampleQueue = iter->second;
                 assert( sampleQueue.first != nullptr );
 
-                Mix_FreeChunk( sampleQueue.first );
+                if ( !soundSampleCache.release( sampleQueue.first ) ) {
+                    Mix_FreeChunk( sampleQueue.first );
+                }
 
                 // Shift the sample queue
                 sampleQueue.first = sampleQueue.second;
@@ -197,21 +337,15 @@ namespace
         soundSampleManager.channelFinished( channelId );
     }
 
-    int playSound( const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop )
+    // Sample ID is used to cache the sample converted to the audio device format. A negative value means that the sample should not be cached.
+    int playSound( const int sampleId, const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop )
     {
         assert( ptr != nullptr && size != 0 );
 
         soundSampleManager.clearFinishedSamples();
 
-        SDL_RWops * rwops = SDL_RWFromConstMem( ptr, size );
-        if ( rwops == nullptr ) {
-            ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << SDL_GetError() )
-            return -1;
-        }
-
-        Mix_Chunk * sample = Mix_LoadWAV_RW( rwops, 1 );
+        Mix_Chunk * sample = ( sampleId < 0 ) ? SoundSampleCache::loadSample( ptr, size ) : soundSampleCache.acquire( sampleId, ptr, size );
         if ( sample == nullptr ) {
-            ERROR_LOG( "Failed to create an audio chunk from memory. The error: " << Mix_GetError() )
             return -1;
         }
 
@@ -219,7 +353,9 @@ namespace
         if ( channel < 0 ) {
             ERROR_LOG( "Failed to play an audio chunk for channel " << channelId << ". The error: " << Mix_GetError() )
 
-            Mix_FreeChunk( sample );
+            if ( !soundSampleCache.release( sample ) ) {
+                Mix_FreeChunk( sample );
+            }
 
             return channel;
         }
@@ -744,6 +880,7 @@ void Audio::Quit()
         Mix_HookMusicFinished( nullptr );
 
         soundSampleManager.clearFinishedSamples();
+        soundSampleCache.clear();
 
         musicTrackManager.clearFinishedMusic();
         musicTrackManager.clearMusicDB();
@@ -840,6 +977,11 @@ int Mixer::getChannelCount()
 }
 
 int Mixer::Play( const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop )
+{
+    return Play( -1, ptr, size, channelId, loop );
+}
+
+int Mixer::Play( const int sampleId, const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop )
 {
     if ( ptr == nullptr || size == 0 ) {
         // You are trying to play an empty sound. Check your logic!
@@ -853,10 +995,11 @@ int Mixer::Play( const uint8_t * ptr, const uint32_t size, const int channelId,
         return -1;
     }
 
-    return playSound( ptr, size, channelId, loop );
+    return playSound( sampleId, ptr, size, channelId, loop );
 }
 
-int Mixer::PlayFromDistance( const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop, const int16_t angle, const uint8_t volumePercentage )
+int Mixer::PlayFromDistance( const int sampleId, const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop, const int16_t angle,
+                             const uint8_t volumePercentage )
 {
     if ( ptr == nullptr || size == 0 ) {
         // You are trying to play an empty sound. Check your logic!
@@ -870,7 +1013,7 @@ int Mixer::PlayFromDistance( const uint8_t * ptr, const uint32_t size, const int
         return -1;
     }
 
-    const int channel = playSound( ptr, size, channelId, loop );
+    const int channel = playSound( sampleId, ptr, size, channelId, loop );
     if ( channel < 0 ) {
         return channel;
     }
@@ -24,6 +24,7 @@
 #ifndef H2AUDIO_H
 #define H2AUDIO_H
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -51,7 +52,12 @@ namespace Mixer
 
     // To play the audio in a new channel set its value to -1. Returns channel ID. A negative value (-1) in case of failure.
     int Play( const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop );
-    int PlayFromDistance( const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop, const int16_t angle, const uint8_t volumePercentage );
+
+    // Plays the WAV data which is identified by a non-negative sample ID. The sample converted to the audio device format is cached,
+    // so the WAV data is parsed only when the sample with the given ID is played for the first time or after it was evicted from the cache.
+    int Play( const int sampleId, const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop );
+    int PlayFromDistance( const int sampleId, const uint8_t * ptr, const uint32_t size, const int channelId, const bool loop, const int16_t angle,
+                          const uint8_t volumePercentage );
 
     int applySoundEffect( const int channelId, const int16_t angle, const uint8_t volumePercentage );
 
@@ -108,6 +114,7 @@ namespace Music
     void SetMidiSoundFonts( const ListFiles & files );
 
     std::vector<uint8_t> Xmi2Mid( const std::vector<uint8_t> & buf );
+    std::vector<uint8_t> Xmi2Mid( const uint8_t * data, const size_t size );
 }
 
 #endif
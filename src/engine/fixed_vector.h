@@ -0,0 +1,131 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2022                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace fheroes2
+{
+    // Vector-like container with a fixed capacity. Elements are stored inside the object so the container never allocates memory.
+    // It is used for short temporary lists in hot code paths, like indexes of tiles or battlefield cells around another one.
+    template <typename T, size_t Capacity>
+    class FixedVector
+    {
+    public:
+        using value_type = T;
+        using iterator = T *;
+        using const_iterator = const T *;
+
+        void push_back( const T & value )
+        {
+            assert( _size < Capacity );
+            _data[_size++] = value;
+        }
+
+        // Removes elements in [first, last) range and returns an iterator to the element following the removed ones.
+        iterator erase( const_iterator first, const_iterator last )
+        {
+            assert( begin() <= first && first <= last && last <= end() );
+
+            iterator target = begin() + ( first - begin() );
+            iterator source = begin() + ( last - begin() );
+
+            for ( ; source != end(); ++source, ++target ) {
+                *target = *source;
+            }
+
+            const iterator result = begin() + ( first - begin() );
+            _size -= static_cast<size_t>( last - first );
+
+            return result;
+        }
+
+        void clear()
+        {
+            _size = 0;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        static constexpr size_t capacity()
+        {
+            return Capacity;
+        }
+
+        T & operator[]( const size_t index )
+        {
+            assert( index < _size );
+            return _data[index];
+        }
+
+        const T & operator[]( const size_t index ) const
+        {
+            assert( index < _size );
+            return _data[index];
+        }
+
+        T & front()
+        {
+            assert( _size > 0 );
+            return _data[0];
+        }
+
+        const T & front() const
+        {
+            assert( _size > 0 );
+            return _data[0];
+        }
+
+        iterator begin()
+        {
+            return _data.data();
+        }
+
+        iterator end()
+        {
+            return _data.data() + _size;
+        }
+
+        const_iterator begin() const
+        {
+            return _data.data();
+        }
+
+        const_iterator end() const
+        {
+            return _data.data() + _size;
+        }
+
+    private:
+        std::array<T, Capacity> _data{};
+        size_t _size{ 0 };
+    };
+}
@@ -1253,34 +1253,14 @@ namespace fheroes2
 
         Sprite contour( width, height );
         contour.reset();
-        if ( width < 2 || height < 2 ) {
-            return contour;
-        }
 
-        assert( !contour.empty() );
-
-        const uint8_t * inY = image.transform();
-        uint8_t * outImageY = contour.image();
-        uint8_t * outTransformY = contour.transform();
+        uint8_t * outImage = contour.image();
+        uint8_t * outTransform = contour.transform();
 
-        const int32_t reducedWidth = width - 1;
-        const int32_t reducedHeight = height - 1;
-
-        for ( int32_t y = 0; y < height; ++y, inY += width, outImageY += width, outTransformY += width ) {
-            const uint8_t * inX = inY;
-
-            const bool isNotTopRow = ( y > 0 );
-            const bool isNotBottomRow = ( y < reducedHeight );
-
-            for ( int32_t x = 0; x < width; ++x, ++inX ) {
-                if ( *inX > 0 && *inX < 6 ) { // 1 is to skip, 2 - 5 types of shadows
-                    if ( ( x > 0 && *( inX - 1 ) == 0 ) || ( x < reducedWidth && *( inX + 1 ) == 0 ) || ( isNotTopRow && *( inX - width ) == 0 )
-                         || ( isNotBottomRow && *( inX + width ) == 0 ) ) {
-                        outImageY[x] = value;
-                        outTransformY[x] = 0;
-                    }
-                }
-            }
+        for ( const Point & point : GetContourPoints( image ) ) {
+            const int32_t offset = point.y * width + point.x;
+            outImage[offset] = value;
+            outTransform[offset] = 0;
         }
 
         return contour;
@@ -1443,6 +1423,35 @@ namespace fheroes2
         }
     }
 
+    void DrawContour( Image & out, const std::vector<Point> & contour, int32_t imageWidth, int32_t outX, int32_t outY, uint8_t value, bool flip )
+    {
+        if ( out.empty() ) {
+            return;
+        }
+
+        const int32_t outWidth = out.width();
+        const int32_t outHeight = out.height();
+
+        uint8_t * outImage = out.image();
+        uint8_t * outTransform = out.singleLayer() ? nullptr : out.transform();
+
+        for ( const Point & point : contour ) {
+            const int32_t x = outX + ( flip ? imageWidth - 1 - point.x : point.x );
+            const int32_t y = outY + point.y;
+
+            if ( x < 0 || y < 0 || x >= outWidth || y >= outHeight ) {
+                continue;
+            }
+
+            const int32_t offset = y * outWidth + x;
+            outImage[offset] = value;
+
+            if ( outTransform != nullptr ) {
+                outTransform[offset] = 0;
+            }
+        }
+    }
+
     void DrawLine( Image & image, const Point & start, const Point & end, uint8_t value, const Rect & roi )
     {
         if ( image.empty() )
@@ -1908,6 +1917,41 @@ namespace fheroes2
         return GetPALColorId( red / 4, green / 4, blue / 4 );
     }
 
+    std::vector<Point> GetContourPoints( const Image & image )
+    {
+        std::vector<Point> contour;
+
+        const int32_t width = image.width();
+        const int32_t height = image.height();
+
+        if ( width < 2 || height < 2 ) {
+            return contour;
+        }
+
+        const uint8_t * inY = image.transform();
+
+        const int32_t reducedWidth = width - 1;
+        const int32_t reducedHeight = height - 1;
+
+        for ( int32_t y = 0; y < height; ++y, inY += width ) {
+            const uint8_t * inX = inY;
+
+            const bool isNotTopRow = ( y > 0 );
+            const bool isNotBottomRow = ( y < reducedHeight );
+
+            for ( int32_t x = 0; x < width; ++x, ++inX ) {
+                if ( *inX > 0 && *inX < 6 ) { // 1 is to skip, 2 - 5 types of shadows
+                    if ( ( x > 0 && *( inX - 1 ) == 0 ) || ( x < reducedWidth && *( inX + 1 ) == 0 ) || ( isNotTopRow && *( inX - width ) == 0 )
+                         || ( isNotBottomRow && *( inX + width ) == 0 ) ) {
+                        contour.emplace_back( x, y );
+                    }
+                }
+            }
+        }
+
+        return contour;
+    }
+
     std::vector<uint8_t> getTransformTable( const Image & in, const Image & out, int32_t x, int32_t y, int32_t width, int32_t height )
     {
         std::vector<uint8_t> table( 256 );
@@ -233,6 +233,9 @@ namespace fheroes2
     // skipFactor is responsible for non-solid line. You can interpret it as skip every N pixel
     void DrawBorder( Image & image, uint8_t value, uint32_t skipFactor = 0 );
 
+    // Draws the contour returned by GetContourPoints() for an image of the given width. Flipping is done the same way as Blit() does it.
+    void DrawContour( Image & out, const std::vector<Point> & contour, int32_t imageWidth, int32_t outX, int32_t outY, uint8_t value, bool flip = false );
+
     // roi is an optional parameter when you need to draw in a small than image area
     void DrawLine( Image & image, const Point & start, const Point & end, uint8_t value, const Rect & roi = Rect() );
 
@@ -262,6 +265,9 @@ namespace fheroes2
     // Returns a closest color ID from the original game's palette
     uint8_t GetColorId( uint8_t red, uint8_t green, uint8_t blue );
 
+    // Returns positions of the image pixels which form the contour of the image, the same pixels which CreateContour() sets.
+    std::vector<Point> GetContourPoints( const Image & image );
+
     std::vector<uint8_t> getTransformTable( const Image & in, const Image & out, int32_t x, int32_t y, int32_t width, int32_t height );
 
     Sprite makeShadow( const Sprite & in, const Point & shadowOffset, const uint8_t transformId );
@@ -0,0 +1,193 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2022                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "mapped_file.h"
+
+#if defined( _WIN32 )
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif !defined( TARGET_PS_VITA ) && !defined( TARGET_NINTENDO_SWITCH ) && ( defined( __unix__ ) || defined( __APPLE__ ) )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FHEROES2_POSIX_MMAP
+#endif
+
+#include "logging.h"
+
+namespace fheroes2
+{
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    bool MappedFile::open( const std::string & fileName )
+    {
+        close();
+
+        if ( _map( fileName ) ) {
+            return true;
+        }
+
+        DEBUG_LOG( DBG_ENGINE, DBG_TRACE, "Memory mapping is not available for " << fileName << ", switching to buffered reads." )
+
+        std::scoped_lock<std::mutex> lock( _streamMutex );
+
+        if ( !_stream.open( fileName, "rb" ) ) {
+            return false;
+        }
+
+        _size = _stream.size();
+
+        return _size > 0;
+    }
+
+    void MappedFile::close()
+    {
+        _unmap();
+
+        std::scoped_lock<std::mutex> lock( _streamMutex );
+
+        _stream.close();
+        _size = 0;
+    }
+
+    FileData MappedFile::read( const size_t offset, const size_t size ) const
+    {
+        if ( size == 0 || offset >= _size || size > _size - offset ) {
+            return {};
+        }
+
+        if ( _mapping != nullptr ) {
+            return { _mapping + offset, size };
+        }
+
+        std::scoped_lock<std::mutex> lock( _streamMutex );
+
+        _stream.seek( offset );
+
+        return FileData( _stream.getRaw( size ) );
+    }
+
+#if defined( _WIN32 )
+    bool MappedFile::_map( const std::string & fileName )
+    {
+        HANDLE file = CreateFileA( fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+        if ( file == INVALID_HANDLE_VALUE ) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if ( !GetFileSizeEx( file, &fileSize ) || fileSize.QuadPart <= 0 ) {
+            CloseHandle( file );
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( mapping == nullptr ) {
+            CloseHandle( file );
+            return false;
+        }
+
+        const void * view = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+        if ( view == nullptr ) {
+            CloseHandle( mapping );
+            CloseHandle( file );
+            return false;
+        }
+
+        _fileHandle = file;
+        _mappingHandle = mapping;
+        _mapping = static_cast<const uint8_t *>( view );
+        _size = static_cast<size_t>( fileSize.QuadPart );
+
+        return true;
+    }
+
+    void MappedFile::_unmap()
+    {
+        if ( _mapping != nullptr ) {
+            UnmapViewOfFile( _mapping );
+            _mapping = nullptr;
+        }
+
+        if ( _mappingHandle != nullptr ) {
+            CloseHandle( _mappingHandle );
+            _mappingHandle = nullptr;
+        }
+
+        if ( _fileHandle != nullptr ) {
+            CloseHandle( _fileHandle );
+            _fileHandle = nullptr;
+        }
+    }
+#elif defined( FHEROES2_POSIX_MMAP )
+    bool MappedFile::_map( const std::string & fileName )
+    {
+        const int file = ::open( fileName.c_str(), O_RDONLY );
+        if ( file < 0 ) {
+            return false;
+        }
+
+        struct stat fileInfo;
+        if ( fstat( file, &fileInfo ) != 0 || fileInfo.st_size <= 0 ) {
+            ::close( file );
+            return false;
+        }
+
+        const size_t fileSize = static_cast<size_t>( fileInfo.st_size );
+
+        void * view = mmap( nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0 );
+
+        // The mapping keeps its own reference to the file.
+        ::close( file );
+
+        if ( view == MAP_FAILED ) {
+            return false;
+        }
+
+        _mapping = static_cast<const uint8_t *>( view );
+        _size = fileSize;
+
+        return true;
+    }
+
+    void MappedFile::_unmap()
+    {
+        if ( _mapping != nullptr ) {
+            munmap( const_cast<uint8_t *>( _mapping ), _size );
+            _mapping = nullptr;
+        }
+    }
+#else
+    bool MappedFile::_map( const std::string & /* fileName */ )
+    {
+        return false;
+    }
+
+    void MappedFile::_unmap()
+    {
+        // Do nothing.
+    }
+#endif
+}
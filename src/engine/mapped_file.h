@@ -0,0 +1,140 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2022                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "serialize.h"
+
+namespace fheroes2
+{
+    // Read-only block of bytes returned by MappedFile. It points directly to the memory mapped file if possible,
+    // otherwise it owns a copy of the data. In the first case it is valid only while the file is open.
+    class FileData
+    {
+    public:
+        FileData() = default;
+
+        FileData( const uint8_t * data, const size_t size )
+            : _data( data )
+            , _size( size )
+        {
+            // Do nothing.
+        }
+
+        explicit FileData( std::vector<uint8_t> && buffer )
+            : _buffer( std::move( buffer ) )
+            , _data( _buffer.data() )
+            , _size( _buffer.size() )
+        {
+            // Do nothing.
+        }
+
+        FileData( const FileData & ) = delete;
+        FileData( FileData && ) noexcept = default;
+
+        ~FileData() = default;
+
+        FileData & operator=( const FileData & ) = delete;
+        FileData & operator=( FileData && ) noexcept = default;
+
+        const uint8_t * data() const
+        {
+            return _data;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        std::vector<uint8_t> toVector() const
+        {
+            return { _data, _data + _size };
+        }
+
+    private:
+        // Moving std::vector does not change the address of its data so _data stays valid after moving this object.
+        std::vector<uint8_t> _buffer;
+
+        const uint8_t * _data{ nullptr };
+        size_t _size{ 0 };
+    };
+
+    // Read-only file which is mapped into memory when the platform supports it. Otherwise data is read using ordinary file operations.
+    // All read operations are thread-safe.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        MappedFile( const MappedFile & ) = delete;
+
+        ~MappedFile();
+
+        MappedFile & operator=( const MappedFile & ) = delete;
+
+        bool open( const std::string & fileName );
+        void close();
+
+        bool isOpen() const
+        {
+            return _size > 0;
+        }
+
+        bool isMapped() const
+        {
+            return _mapping != nullptr;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        // Returns an empty object if the requested block is out of the file bounds.
+        FileData read( const size_t offset, const size_t size ) const;
+
+    private:
+        const uint8_t * _mapping{ nullptr };
+        size_t _size{ 0 };
+
+#if defined( _WIN32 )
+        void * _fileHandle{ nullptr };
+        void * _mappingHandle{ nullptr };
+#endif
+
+        // Used only when memory mapping is not available.
+        mutable StreamFile _stream;
+        mutable std::mutex _streamMutex;
+
+        bool _map( const std::string & fileName );
+        void _unmap();
+    };
+}
@@ -50,7 +50,7 @@ uint32_t Rand::GetWithSeed( uint32_t from, uint32_t to, uint32_t seed )
         std::swap( from, to );
 
     std::uniform_int_distribution<uint32_t> distrib( from, to );
-    std::mt19937 seededGen( seed );
+    SeededMersenneTwister seededGen( seed );
 
     return distrib( seededGen );
 }
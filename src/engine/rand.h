@@ -24,7 +24,9 @@
 #define H2RAND_H
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
@@ -36,6 +38,73 @@
 
 namespace Rand
 {
+    // Random number generator which produces exactly the same sequence of numbers as std::mt19937 initialized by the same seed.
+    // Seeded generators are usually created to get only a few random numbers. Unlike std::mt19937 which initializes and regenerates
+    // its whole state of 624 numbers at once, this generator calculates its state lazily, only as far as needed for the requested numbers.
+    class SeededMersenneTwister
+    {
+    public:
+        using result_type = uint32_t;
+
+        explicit SeededMersenneTwister( const uint32_t seed )
+        {
+            _state[0] = seed;
+        }
+
+        SeededMersenneTwister( const SeededMersenneTwister & ) = delete;
+        SeededMersenneTwister & operator=( const SeededMersenneTwister & ) = delete;
+
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return 0xFFFFFFFF;
+        }
+
+        result_type operator()()
+        {
+            if ( _index == stateSize ) {
+                _index = 0;
+            }
+
+            // The state is regenerated in place one number at a time. Each number depends on the next one and on the number 397 positions further.
+            initializeState( std::min( _index + shiftSize + 1, stateSize ) );
+
+            const uint32_t value = ( _state[_index] & 0x80000000 ) | ( _state[( _index + 1 ) % stateSize] & 0x7FFFFFFF );
+            _state[_index] = _state[( _index + shiftSize ) % stateSize] ^ ( value >> 1 ) ^ ( ( value & 1 ) ? 0x9908B0DF : 0 );
+
+            uint32_t result = _state[_index];
+            ++_index;
+
+            result ^= result >> 11;
+            result ^= ( result << 7 ) & 0x9D2C5680;
+            result ^= ( result << 15 ) & 0xEFC60000;
+            result ^= result >> 18;
+
+            return result;
+        }
+
+    private:
+        static constexpr size_t stateSize = 624;
+        static constexpr size_t shiftSize = 397;
+
+        // Only the first _initializedSize elements of the state are initialized.
+        std::array<uint32_t, stateSize> _state;
+        size_t _initializedSize{ 1 };
+        size_t _index{ 0 };
+
+        void initializeState( const size_t size )
+        {
+            for ( ; _initializedSize < size; ++_initializedSize ) {
+                const uint32_t previous = _state[_initializedSize - 1];
+                _state[_initializedSize] = 1812433253 * ( previous ^ ( previous >> 30 ) ) + static_cast<uint32_t>( _initializedSize );
+            }
+        }
+    };
+
     std::mt19937 & CurrentThreadRandomDevice();
 
     uint32_t Get( uint32_t from, uint32_t to = 0 );
@@ -56,11 +125,12 @@ namespace Rand
         std::shuffle( vec.begin(), vec.end(), CurrentThreadRandomDevice() );
     }
 
-    template <typename T>
-    void ShuffleWithSeed( std::vector<T> & vec, uint32_t seed )
+    // Container can be any sequence with random access iterators.
+    template <typename Container>
+    void ShuffleWithSeed( Container & container, uint32_t seed )
     {
-        std::mt19937 seededGen( seed );
-        std::shuffle( vec.begin(), vec.end(), seededGen );
+        SeededMersenneTwister seededGen( seed );
+        std::shuffle( container.begin(), container.end(), seededGen );
     }
 
     template <typename T>
@@ -131,16 +201,17 @@ namespace Rand
         template <typename T>
         const T & Get( const std::vector<T> & vec ) const
         {
+            assert( !vec.empty() );
+
             ++_currentSeed;
-            std::mt19937 seededGen( _currentSeed );
-            return Rand::GetWithGen( vec, seededGen );
+            return vec[Rand::GetWithSeed( 0, static_cast<uint32_t>( vec.size() - 1 ), _currentSeed )];
         }
 
-        template <class T>
-        void Shuffle( std::vector<T> & vector ) const
+        template <class Container>
+        void Shuffle( Container & container ) const
         {
             ++_currentSeed;
-            Rand::ShuffleWithSeed( vector, _currentSeed );
+            Rand::ShuffleWithSeed( container, _currentSeed );
         }
 
     private:
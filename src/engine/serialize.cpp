@@ -113,11 +113,16 @@ StreamBase & StreamBase::operator>>( int32_t & v )
 
 StreamBase & StreamBase::operator>>( std::string & v )
 {
-    uint32_t size = get32();
-    v.resize( size );
+    const uint32_t size = get32();
+    if ( size == 0 ) {
+        v.clear();
+        return *this;
+    }
 
-    for ( std::string::iterator it = v.begin(); it != v.end(); ++it )
-        *it = get8();
+    const std::vector<uint8_t> raw = getRaw( size );
+    v.assign( raw.begin(), raw.end() );
+    // A failed read might return less data than requested.
+    v.resize( size );
 
     return *this;
 }
@@ -182,9 +187,7 @@ StreamBase & StreamBase::operator<<( const uint32_t v )
 StreamBase & StreamBase::operator<<( const std::string & v )
 {
     put32( static_cast<uint32_t>( v.size() ) );
-
-    for ( std::string::const_iterator it = v.begin(); it != v.end(); ++it )
-        put8( *it );
+    putRaw( v.data(), v.size() );
 
     return *this;
 }
@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <iterator>
 #include <list>
 #include <map>
@@ -144,6 +145,11 @@ public:
     StreamBase & operator>>( std::vector<Type> & v )
     {
         const uint32_t size = get32();
+        if constexpr ( isBulkSerializable<Type> ) {
+            getBulk( v, size );
+            return *this;
+        }
+
         v.resize( size );
         for ( typename std::vector<Type>::iterator it = v.begin(); it != v.end(); ++it )
             *this >> *it;
@@ -183,6 +189,11 @@ public:
     StreamBase & operator<<( const std::vector<Type> & v )
     {
         put32( static_cast<uint32_t>( v.size() ) );
+        if constexpr ( isBulkSerializable<Type> ) {
+            putBulk( v );
+            return *this;
+        }
+
         for ( typename std::vector<Type>::const_iterator it = v.begin(); it != v.end(); ++it )
             *this << *it;
         return *this;
@@ -209,6 +220,90 @@ public:
 protected:
     size_t flags;
 
+    // Integer types which are serialized with their own size in the stream's byte order. Vectors of these types are read and written
+    // as a single block of memory instead of calling virtual methods for every element.
+    template <class Type>
+    static constexpr bool isBulkSerializable
+        = std::is_integral_v<Type> && !std::is_same_v<Type, bool> && ( sizeof( Type ) == 1 || sizeof( Type ) == 2 || sizeof( Type ) == 4 );
+
+    template <class Type>
+    void getBulk( std::vector<Type> & v, const uint32_t size )
+    {
+        static_assert( isBulkSerializable<Type> );
+
+        if ( size == 0 ) {
+            v.clear();
+            return;
+        }
+
+        std::vector<uint8_t> raw = getRaw( sizeof( Type ) * size );
+        // A failed read might return less data than requested.
+        raw.resize( sizeof( Type ) * size, 0 );
+
+        if constexpr ( std::is_same_v<Type, uint8_t> ) {
+            v = std::move( raw );
+        }
+        else {
+            v.resize( size );
+
+            const uint8_t * data = raw.data();
+            const bool isBigEndian = bigendian();
+
+            for ( Type & value : v ) {
+                if constexpr ( sizeof( Type ) == 1 ) {
+                    value = static_cast<Type>( *data );
+                }
+                else if constexpr ( sizeof( Type ) == 2 ) {
+                    uint16_t temp;
+                    std::memcpy( &temp, data, sizeof( temp ) );
+                    value = static_cast<Type>( isBigEndian ? be16toh( temp ) : le16toh( temp ) );
+                }
+                else {
+                    uint32_t temp;
+                    std::memcpy( &temp, data, sizeof( temp ) );
+                    value = static_cast<Type>( isBigEndian ? be32toh( temp ) : le32toh( temp ) );
+                }
+
+                data += sizeof( Type );
+            }
+        }
+    }
+
+    template <class Type>
+    void putBulk( const std::vector<Type> & v )
+    {
+        static_assert( isBulkSerializable<Type> );
+
+        if ( v.empty() ) {
+            return;
+        }
+
+        if constexpr ( sizeof( Type ) == 1 ) {
+            putRaw( reinterpret_cast<const char *>( v.data() ), v.size() );
+        }
+        else {
+            std::vector<uint8_t> raw( sizeof( Type ) * v.size() );
+
+            uint8_t * data = raw.data();
+            const bool isBigEndian = bigendian();
+
+            for ( const Type value : v ) {
+                if constexpr ( sizeof( Type ) == 2 ) {
+                    const uint16_t temp = isBigEndian ? htobe16( static_cast<uint16_t>( value ) ) : htole16( static_cast<uint16_t>( value ) );
+                    std::memcpy( data, &temp, sizeof( temp ) );
+                }
+                else {
+                    const uint32_t temp = isBigEndian ? htobe32( static_cast<uint32_t>( value ) ) : htole32( static_cast<uint32_t>( value ) );
+                    std::memcpy( data, &temp, sizeof( temp ) );
+                }
+
+                data += sizeof( Type );
+            }
+
+            putRaw( reinterpret_cast<const char *>( raw.data() ), raw.size() );
+        }
+    }
+
     virtual uint8_t get8() = 0;
     virtual void put8( const uint8_t ) = 0;
 
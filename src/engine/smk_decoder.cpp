@@ -20,20 +20,168 @@
 
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <utility>
 
 #include "image.h"
 #include "serialize.h"
 #include "smacker.h"
 #include "smk_decoder.h"
+#include "thread.h"
 
 namespace
 {
     const size_t audioHeaderSize = 44;
+
+    const size_t paletteSize = 256 * 3;
+
+    // The maximum number of frames decoded ahead of the shown one.
+    const size_t decodedFrameQueueSize = 8;
 }
 
+// Decodes video frames in a separate thread ahead of time so decoding does not delay rendering of frames and processing of user input.
+// Once the worker thread is started only this thread accesses the video file.
+class SMKVideoSequence::FrameDecoder final : public MultiThreading::AsyncManager
+{
+public:
+    FrameDecoder( smk videoFile, const unsigned long frameCount, const size_t frameSize )
+        : _videoFile( videoFile )
+        , _frameCount( frameCount )
+        , _frameSize( frameSize )
+    {
+        // Do nothing.
+    }
+
+    // Waits until the next frame is decoded and returns it in place of the given frame.
+    void takeFrame( DecodedFrame & frame )
+    {
+        createWorker();
+
+        std::unique_lock<std::mutex> lock( _mutex );
+
+        // The worker might be idle if the queue was full or the decoder has just been created.
+        notifyWorker();
+
+        _frameNotification.wait( lock, [this] { return !_decodedFrames.empty(); } );
+
+        std::swap( frame, _decodedFrames.front() );
+
+        // Buffers of the given frame are reused for one of the next frames.
+        _freeFrames.emplace_back( std::move( _decodedFrames.front() ) );
+        _decodedFrames.pop_front();
+
+        // Continue decoding as a place in the queue has become free.
+        notifyWorker();
+    }
+
+    // Drops all decoded frames and starts decoding from the first frame.
+    void restart()
+    {
+        std::scoped_lock<std::mutex> lock( _mutex );
+
+        for ( DecodedFrame & frame : _decodedFrames ) {
+            _freeFrames.emplace_back( std::move( frame ) );
+        }
+        _decodedFrames.clear();
+
+        _nextFrameId = 0;
+        _isRestartRequested = true;
+
+        // A frame which is being decoded at the moment must be dropped as well.
+        ++_generation;
+
+        notifyWorker();
+    }
+
+private:
+    const smk _videoFile;
+    const unsigned long _frameCount;
+    const size_t _frameSize;
+
+    // The following members are protected by _mutex.
+    std::deque<DecodedFrame> _decodedFrames;
+    std::vector<DecodedFrame> _freeFrames;
+    std::condition_variable _frameNotification;
+    unsigned long _nextFrameId{ 0 };
+    uint32_t _generation{ 0 };
+    bool _isRestartRequested{ false };
+
+    // The following members are accessed only by the worker thread.
+    DecodedFrame _taskFrame;
+    uint32_t _taskGeneration{ 0 };
+    bool _isTaskRestart{ false };
+    bool _isTaskDecode{ false };
+    unsigned long _videoFileFrameId{ 0 };
+
+    // This method is called by the worker thread and is protected by _mutex
+    bool prepareTask() override
+    {
+        _isTaskRestart = _isRestartRequested;
+        _isRestartRequested = false;
+
+        _taskGeneration = _generation;
+
+        if ( _decodedFrames.size() >= decodedFrameQueueSize || _nextFrameId >= _frameCount ) {
+            _isTaskDecode = false;
+            return false;
+        }
+
+        _isTaskDecode = true;
+        ++_nextFrameId;
+
+        if ( !_freeFrames.empty() ) {
+            std::swap( _taskFrame, _freeFrames.back() );
+            _freeFrames.pop_back();
+        }
+
+        return ( _decodedFrames.size() + 1 < decodedFrameQueueSize ) && ( _nextFrameId < _frameCount );
+    }
+
+    // This method is called by the worker thread, but is not protected by _mutex
+    void executeTask() override
+    {
+        if ( _isTaskRestart ) {
+            smk_first( _videoFile );
+            _videoFileFrameId = 0;
+        }
+
+        if ( !_isTaskDecode ) {
+            return;
+        }
+
+        const uint8_t * data = smk_get_video( _videoFile );
+        const uint8_t * paletteData = smk_get_palette( _videoFile );
+        assert( data != nullptr && paletteData != nullptr );
+
+        _taskFrame.image.assign( data, data + _frameSize );
+        _taskFrame.palette.assign( paletteData, paletteData + paletteSize );
+
+        ++_videoFileFrameId;
+        if ( _videoFileFrameId < _frameCount ) {
+            smk_next( _videoFile );
+        }
+
+        {
+            std::scoped_lock<std::mutex> lock( _mutex );
+
+            if ( _taskGeneration != _generation ) {
+                // The decoder has been restarted while this frame was being decoded.
+                return;
+            }
+
+            _decodedFrames.emplace_back( std::move( _taskFrame ) );
+            _taskFrame = {};
+        }
+
+        _frameNotification.notify_one();
+    }
+};
+
 SMKVideoSequence::SMKVideoSequence( const std::string & filePath )
     : _width( 0 )
     , _height( 0 )
@@ -173,10 +321,25 @@ SMKVideoSequence::SMKVideoSequence( const std::string & filePath )
 
     smk_enable_video( _videoFile, 1 ); // enable video reading
     smk_first( _videoFile );
+
+    const uint8_t * paletteData = smk_get_palette( _videoFile );
+    if ( paletteData != nullptr ) {
+        _currentFrame.palette.assign( paletteData, paletteData + paletteSize );
+    }
+
+    if ( _frameCount > 0 ) {
+        _frameDecoder = std::make_unique<FrameDecoder>( _videoFile, _frameCount, static_cast<size_t>( width ) * height );
+    }
 }
 
 SMKVideoSequence::~SMKVideoSequence()
 {
+    // The decoder must be stopped before the video file is closed.
+    if ( _frameDecoder ) {
+        _frameDecoder->stopWorker();
+        _frameDecoder.reset();
+    }
+
     if ( _videoFile != nullptr ) {
         smk_close( _videoFile );
     }
@@ -204,23 +367,27 @@ unsigned long SMKVideoSequence::frameCount() const
 
 void SMKVideoSequence::resetFrame()
 {
-    if ( _videoFile == nullptr )
+    if ( _frameDecoder == nullptr )
         return;
 
-    smk_first( _videoFile );
+    _frameDecoder->restart();
     _currentFrameId = 0;
 }
 
 void SMKVideoSequence::getNextFrame( fheroes2::Image & image, const int32_t x, const int32_t y, int32_t & width, int32_t & height, std::vector<uint8_t> & palette )
 {
-    if ( _videoFile == nullptr || image.empty() || x < 0 || y < 0 || x >= image.width() || y >= image.height() || !image.singleLayer() ) {
+    if ( _frameDecoder == nullptr || image.empty() || x < 0 || y < 0 || x >= image.width() || y >= image.height() || !image.singleLayer() ) {
         width = 0;
         height = 0;
         return;
     }
 
-    const uint8_t * data = smk_get_video( _videoFile );
-    const uint8_t * paletteData = smk_get_palette( _videoFile );
+    // The last frame is shown again if the end of the video is reached.
+    if ( _currentFrameId < _frameCount || _currentFrame.image.empty() ) {
+        _frameDecoder->takeFrame( _currentFrame );
+    }
+
+    const uint8_t * data = _currentFrame.image.data();
 
     width = _width;
     height = _height;
@@ -274,21 +441,16 @@ void SMKVideoSequence::getNextFrame( fheroes2::Image & image, const int32_t x, c
         }
     }
 
-    palette.resize( 256 * 3 );
-    memcpy( palette.data(), paletteData, 256 * 3 );
+    palette = _currentFrame.palette;
 
     ++_currentFrameId;
-    if ( _currentFrameId < _frameCount ) {
-        smk_next( _videoFile );
-    }
 }
 
 std::vector<uint8_t> SMKVideoSequence::getCurrentPalette() const
 {
-    const uint8_t * paletteData = smk_get_palette( _videoFile );
-    assert( paletteData != nullptr );
+    assert( _currentFrame.palette.size() == paletteSize );
 
-    return std::vector<uint8_t>( paletteData, paletteData + 256 * 3 );
+    return _currentFrame.palette;
 }
 
 const std::vector<std::vector<uint8_t>> & SMKVideoSequence::getAudioChannels() const
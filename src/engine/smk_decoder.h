@@ -21,6 +21,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,7 @@ public:
     // If the image is smaller than the frame then only a part of the frame will be drawn.
     void getNextFrame( fheroes2::Image & image, const int32_t x, const int32_t y, int32_t & width, int32_t & height, std::vector<uint8_t> & palette );
 
+    // Returns the palette of the last frame returned by getNextFrame() or the palette of the first frame if no frames have been returned yet.
     std::vector<uint8_t> getCurrentPalette() const;
 
     const std::vector<std::vector<uint8_t>> & getAudioChannels() const;
@@ -59,6 +61,14 @@ public:
     }
 
 private:
+    struct DecodedFrame
+    {
+        std::vector<uint8_t> image;
+        std::vector<uint8_t> palette;
+    };
+
+    class FrameDecoder;
+
     std::vector<std::vector<uint8_t>> _audioChannel;
     int32_t _width;
     int32_t _height;
@@ -68,4 +78,7 @@ private:
     unsigned long _currentFrameId;
 
     struct smk_t * _videoFile;
+
+    DecodedFrame _currentFrame;
+    std::unique_ptr<FrameDecoder> _frameDecoder;
 };
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -142,44 +143,87 @@ namespace
         LOCALE_UK
     };
 
-    struct chunk
+    // FNV-1a hash of a null-terminated string. A 64-bit hash is used to make collisions between translation strings practically impossible.
+    uint64_t getStringHash( const char * str )
     {
-        uint32_t offset;
-        uint32_t length;
+        uint64_t hash = 0xCBF29CE484222325;
 
-        chunk()
-            : offset( 0 )
-            , length( 0 )
-        {
-            // Do nothing.
+        for ( ; *str; ++str ) {
+            hash ^= static_cast<unsigned char>( *str );
+            hash *= 0x100000001B3;
         }
 
-        chunk( const uint32_t off, const uint32_t len )
-            : offset( off )
-            , length( len )
+        // Zero hash is reserved for empty slots of the hash table.
+        return hash != 0 ? hash : 1;
+    }
+
+    // Flat hash table with open addressing built once when a translation file is loaded. It maps the hash of an original string
+    // to the offset of its translation. Lookups do not allocate memory and touch a single contiguous memory block.
+    class TranslationTable
+    {
+    public:
+        void reserve( const size_t count )
         {
-            // Do nothing.
+            size_t size = 16;
+            // Keep the load factor under 50% to make probing sequences short.
+            while ( size < count * 2 ) {
+                size *= 2;
+            }
+
+            _entries.clear();
+            _entries.resize( size );
         }
-    };
 
-    uint32_t crc32b( const char * msg )
-    {
-        uint32_t crc = 0xFFFFFFFF;
-        uint32_t index = 0;
+        // Returns false if the table already contains the given hash.
+        bool add( const uint64_t hash, const uint32_t offset )
+        {
+            assert( hash != 0 && !_entries.empty() );
+
+            const size_t mask = _entries.size() - 1;
+
+            for ( size_t id = static_cast<size_t>( hash ) & mask;; id = ( id + 1 ) & mask ) {
+                Entry & entry = _entries[id];
+                if ( entry.hash == hash ) {
+                    return false;
+                }
 
-        while ( msg[index] ) {
-            crc ^= static_cast<uint32_t>( msg[index] );
+                if ( entry.hash == 0 ) {
+                    entry.hash = hash;
+                    entry.offset = offset;
+                    return true;
+                }
+            }
+        }
 
-            for ( int bit = 0; bit < 8; ++bit ) {
-                const uint32_t poly = ( crc & 1 ) ? 0xEDB88320 : 0x0;
-                crc = ( crc >> 1 ) ^ poly;
+        const uint32_t * find( const uint64_t hash ) const
+        {
+            if ( _entries.empty() ) {
+                return nullptr;
             }
 
-            ++index;
+            const size_t mask = _entries.size() - 1;
+
+            for ( size_t id = static_cast<size_t>( hash ) & mask;; id = ( id + 1 ) & mask ) {
+                const Entry & entry = _entries[id];
+                if ( entry.hash == hash ) {
+                    return &entry.offset;
+                }
+
+                if ( entry.hash == 0 ) {
+                    return nullptr;
+                }
+            }
         }
 
-        return ~crc;
-    }
+    private:
+        struct Entry
+        {
+            uint64_t hash{ 0 };
+            uint32_t offset{ 0 };
+        };
+
+        std::vector<Entry> _entries;
+    };
 
     std::string getTag( const std::string & str, const std::string & tag, const std::string & sep )
     {
@@ -209,7 +253,7 @@ namespace
         uint32_t hash_offset;
         LocaleType locale;
         StreamBuf buf;
-        std::map<uint32_t, chunk> hash_offsets;
+        TranslationTable hash_offsets;
         std::string domain;
         std::string encoding;
         std::string plural_forms;
@@ -229,11 +273,11 @@ namespace
 
         const char * ngettext( const char * str, size_t plural )
         {
-            std::map<uint32_t, chunk>::const_iterator it = hash_offsets.find( crc32b( str ) );
-            if ( it == hash_offsets.end() )
+            const uint32_t * offset = hash_offsets.find( getStringHash( str ) );
+            if ( offset == nullptr )
                 return stripContext( str );
 
-            buf.seek( ( *it ).second.offset );
+            buf.seek( *offset );
             const uint8_t * ptr = buf.data();
 
             while ( plural > 0 ) {
@@ -301,6 +345,8 @@ namespace
 
             uint32_t totalTranslationStrings = count;
 
+            hash_offsets.reserve( count );
+
             // generate hash table
             for ( uint32_t index = 0; index < count; ++index ) {
                 buf.seek( offset_strings1 + index * 8 /* length, offset */ );
@@ -316,7 +362,7 @@ namespace
                 buf.seek( offset1 );
                 const std::string msg1 = buf.toString( length1 );
 
-                const uint32_t crc = crc32b( msg1.c_str() );
+                const uint64_t hash = getStringHash( msg1.c_str() );
                 buf.seek( offset_strings2 + index * 8 /* length, offset */ );
 
                 const uint32_t length2 = buf.get32();
@@ -328,10 +374,7 @@ namespace
 
                 const uint32_t offset2 = buf.get32();
 
-                std::map<uint32_t, chunk>::const_iterator it = hash_offsets.find( crc );
-                if ( it == hash_offsets.end() )
-                    hash_offsets[crc] = chunk( offset2, length2 );
-                else {
+                if ( !hash_offsets.add( hash, offset2 ) ) {
                     ERROR_LOG( "Incorrect hash value for: " << msg1 )
                 }
             }
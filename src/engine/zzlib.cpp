@@ -22,11 +22,15 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <memory>
+#include <string>
 #include <vector>
 #include <zconf.h>
 #include <zlib.h>
 
+#include "endian_h2.h"
 #include "logging.h"
 #include "zzlib.h"
 
@@ -62,72 +66,536 @@ namespace
         return res;
     }
 
-    std::vector<uint8_t> zlibCompress( const uint8_t * src, size_t srcsz )
+    // Size of chunks in which data is compressed and decompressed.
+    const size_t zlibChunkSize = 64 * 1024;
+
+    // The header of compressed data consists of 3 big-endian 32-bit values: raw data size, compressed data size and an unused field.
+    const size_t zlibHeaderSize = 3 * sizeof( uint32_t );
+
+    void logZlibError( const int code )
     {
-        std::vector<uint8_t> res;
+        std::string errorDesc( "zlib error: " );
+        errorDesc += std::to_string( code );
+        ERROR_LOG( errorDesc.c_str() )
+    }
+}
 
-        if ( src && srcsz ) {
-            res.resize( compressBound( static_cast<uLong>( srcsz ) ) );
-            uLong dstsz = static_cast<uLong>( res.size() );
-            int ret = compress( reinterpret_cast<Bytef *>( &res[0] ), &dstsz, reinterpret_cast<const Bytef *>( src ), static_cast<uLong>( srcsz ) );
+bool ZStreamFile::read( const std::string & fn, size_t offset )
+{
+    ZStreamReader reader;
+    if ( !reader.open( fn, offset ) ) {
+        return false;
+    }
 
-            if ( ret == Z_OK )
-                res.resize( dstsz );
-            else {
-                res.clear();
-                std::string errorDesc( "zlib error: " );
-                errorDesc += std::to_string( ret );
-                ERROR_LOG( errorDesc.c_str() )
+    const std::vector<uint8_t> raw = reader.getRaw();
+    if ( reader.fail() || raw.empty() ) {
+        return false;
+    }
+
+    putRaw( reinterpret_cast<const char *>( raw.data() ), raw.size() );
+    seek( 0 );
+    return !fail();
+}
+
+bool ZStreamFile::write( const std::string & fn, bool append ) const
+{
+    if ( size() == 0 ) {
+        return false;
+    }
+
+    ZStreamWriter writer;
+    if ( !writer.open( fn, append ) ) {
+        return false;
+    }
+
+    writer.putRaw( reinterpret_cast<const char *>( data() ), size() );
+    return writer.close();
+}
+
+// The constructors and destructors are defined here because z_stream is an incomplete type in the header file.
+ZStreamReader::ZStreamReader() = default;
+
+ZStreamReader::~ZStreamReader()
+{
+    close();
+}
+
+bool ZStreamReader::open( const std::string & fileName, const size_t offset )
+{
+    close();
+
+    _file = std::fopen( fileName.c_str(), "rb" );
+    if ( _file == nullptr ) {
+        ERROR_LOG( fileName )
+        return false;
+    }
+
+    uint32_t header[3];
+    if ( ( offset > 0 && std::fseek( _file, static_cast<long>( offset ), SEEK_SET ) != 0 ) || std::fread( header, zlibHeaderSize, 1, _file ) != 1 ) {
+        close();
+        return false;
+    }
+
+    _rawSize = be32toh( header[0] );
+    _compressedSizeLeft = be32toh( header[1] );
+    if ( _rawSize == 0 || _compressedSizeLeft == 0 ) {
+        close();
+        return false;
+    }
+
+    _zstream = std::make_unique<z_stream>();
+
+    const int ret = inflateInit( _zstream.get() );
+    if ( ret != Z_OK ) {
+        logZlibError( ret );
+        _zstream.reset();
+        close();
+        return false;
+    }
+
+    _input.resize( zlibChunkSize );
+    _output.resize( zlibChunkSize );
+
+    setfail( false );
+
+    return true;
+}
+
+void ZStreamReader::close()
+{
+    if ( _zstream ) {
+        inflateEnd( _zstream.get() );
+        _zstream.reset();
+    }
+
+    if ( _file ) {
+        std::fclose( _file );
+        _file = nullptr;
+    }
+
+    _outputPos = 0;
+    _outputSize = 0;
+    _rawSize = 0;
+    _compressedSizeLeft = 0;
+    _isStreamEnd = false;
+}
+
+bool ZStreamReader::_decompressChunk()
+{
+    _outputPos = 0;
+    _outputSize = 0;
+
+    if ( !_zstream || _isStreamEnd ) {
+        return false;
+    }
+
+    z_stream & zs = *_zstream;
+    zs.next_out = _output.data();
+    zs.avail_out = static_cast<uInt>( _output.size() );
+
+    while ( zs.avail_out > 0 ) {
+        if ( zs.avail_in == 0 ) {
+            if ( _compressedSizeLeft == 0 ) {
+                // The compressed data is truncated.
+                setfail( true );
+                break;
             }
+
+            const size_t chunkSize = std::min( _compressedSizeLeft, _input.size() );
+            if ( std::fread( _input.data(), chunkSize, 1, _file ) != 1 ) {
+                setfail( true );
+                break;
+            }
+
+            _compressedSizeLeft -= chunkSize;
+
+            zs.next_in = _input.data();
+            zs.avail_in = static_cast<uInt>( chunkSize );
         }
 
-        return res;
+        const int ret = inflate( &zs, Z_NO_FLUSH );
+        if ( ret == Z_STREAM_END ) {
+            _isStreamEnd = true;
+            break;
+        }
+
+        if ( ret != Z_OK ) {
+            logZlibError( ret );
+            setfail( true );
+            break;
+        }
     }
+
+    _outputSize = _output.size() - zs.avail_out;
+
+    return _outputSize > 0;
 }
 
-bool ZStreamFile::read( const std::string & fn, size_t offset )
+size_t ZStreamReader::tellg() const
+{
+    if ( !_zstream ) {
+        return 0;
+    }
+
+    return static_cast<size_t>( _zstream->total_out ) - ( _outputSize - _outputPos );
+}
+
+size_t ZStreamReader::sizeg() const
+{
+    const size_t pos = tellg();
+    return _rawSize > pos ? _rawSize - pos : 0;
+}
+
+size_t ZStreamReader::tellp() const
+{
+    return 0;
+}
+
+size_t ZStreamReader::sizep() const
+{
+    return 0;
+}
+
+uint8_t ZStreamReader::get8()
+{
+    if ( _outputPos == _outputSize && !_decompressChunk() ) {
+        return 0u;
+    }
+
+    return _output[_outputPos++];
+}
+
+void ZStreamReader::put8( const uint8_t /* v */ )
 {
-    StreamFile sf;
-    sf.setbigendian( true );
+    setfail( true );
+}
+
+void ZStreamReader::skip( size_t sz )
+{
+    while ( sz > 0 ) {
+        if ( _outputPos == _outputSize && !_decompressChunk() ) {
+            return;
+        }
+
+        const size_t skipSize = std::min( sz, _outputSize - _outputPos );
+        _outputPos += skipSize;
+        sz -= skipSize;
+    }
+}
+
+uint16_t ZStreamReader::getBE16()
+{
+    uint16_t result = ( static_cast<uint16_t>( get8() ) << 8 );
+    result |= get8();
+
+    return result;
+}
+
+uint16_t ZStreamReader::getLE16()
+{
+    uint16_t result = get8();
+    result |= ( static_cast<uint16_t>( get8() ) << 8 );
+
+    return result;
+}
 
-    if ( sf.open( fn, "rb" ) ) {
-        if ( offset )
-            sf.seek( offset );
-        const uint32_t size0 = sf.get32(); // raw size
-        if ( size0 == 0 ) {
+uint32_t ZStreamReader::getBE32()
+{
+    uint32_t result = ( static_cast<uint32_t>( getBE16() ) << 16 );
+    result |= getBE16();
+
+    return result;
+}
+
+uint32_t ZStreamReader::getLE32()
+{
+    uint32_t result = getLE16();
+    result |= ( static_cast<uint32_t>( getLE16() ) << 16 );
+
+    return result;
+}
+
+void ZStreamReader::putBE32( uint32_t /* v */ )
+{
+    setfail( true );
+}
+
+void ZStreamReader::putLE32( uint32_t /* v */ )
+{
+    setfail( true );
+}
+
+void ZStreamReader::putBE16( uint16_t /* v */ )
+{
+    setfail( true );
+}
+
+void ZStreamReader::putLE16( uint16_t /* v */ )
+{
+    setfail( true );
+}
+
+std::vector<uint8_t> ZStreamReader::getRaw( size_t sz )
+{
+    const size_t dataSize = sz > 0 ? sz : sizeg();
+
+    std::vector<uint8_t> v( dataSize, 0 );
+
+    size_t copied = 0;
+    while ( copied < dataSize ) {
+        if ( _outputPos == _outputSize && !_decompressChunk() ) {
+            break;
+        }
+
+        const size_t copySize = std::min( dataSize - copied, _outputSize - _outputPos );
+        memcpy( v.data() + copied, _output.data() + _outputPos, copySize );
+
+        _outputPos += copySize;
+        copied += copySize;
+    }
+
+    return v;
+}
+
+void ZStreamReader::putRaw( const char * /* ptr */, size_t /* sz */ )
+{
+    setfail( true );
+}
+
+ZStreamWriter::ZStreamWriter() = default;
+
+ZStreamWriter::~ZStreamWriter()
+{
+    close();
+}
+
+bool ZStreamWriter::open( const std::string & fileName, const bool append, const int compressionLevel )
+{
+    close();
+
+    // The header is updated when all data is written so the file must be seekable.
+    if ( append ) {
+        _file = std::fopen( fileName.c_str(), "r+b" );
+    }
+    if ( _file == nullptr ) {
+        _file = std::fopen( fileName.c_str(), "wb" );
+    }
+    if ( _file == nullptr ) {
+        ERROR_LOG( fileName )
+        return false;
+    }
+
+    const uint32_t header[3] = { 0, 0, 0 };
+    if ( std::fseek( _file, 0, SEEK_END ) != 0 || ( _headerOffset = std::ftell( _file ) ) < 0 || std::fwrite( header, zlibHeaderSize, 1, _file ) != 1 ) {
+        std::fclose( _file );
+        _file = nullptr;
+        return false;
+    }
+
+    _zstream = std::make_unique<z_stream>();
+
+    const int ret = deflateInit( _zstream.get(), compressionLevel );
+    if ( ret != Z_OK ) {
+        logZlibError( ret );
+        _zstream.reset();
+        std::fclose( _file );
+        _file = nullptr;
+        return false;
+    }
+
+    _input.clear();
+    _input.reserve( zlibChunkSize );
+    _output.resize( zlibChunkSize );
+    _rawSize = 0;
+
+    setfail( false );
+
+    return true;
+}
+
+bool ZStreamWriter::close()
+{
+    if ( _file == nullptr ) {
+        return false;
+    }
+
+    if ( !_compress( _input.data(), _input.size(), Z_FINISH ) ) {
+        setfail( true );
+    }
+
+    _input.clear();
+
+    const size_t compressedSize = static_cast<size_t>( _zstream->total_out );
+
+    deflateEnd( _zstream.get() );
+    _zstream.reset();
+
+    if ( _rawSize == 0 || _rawSize > UINT32_MAX || compressedSize > UINT32_MAX ) {
+        setfail( true );
+    }
+
+    if ( !fail() ) {
+        const uint32_t header[3] = { htobe32( static_cast<uint32_t>( _rawSize ) ), htobe32( static_cast<uint32_t>( compressedSize ) ), 0 };
+        if ( std::fseek( _file, _headerOffset, SEEK_SET ) != 0 || std::fwrite( header, zlibHeaderSize, 1, _file ) != 1 ) {
+            setfail( true );
+        }
+    }
+
+    if ( std::fclose( _file ) != 0 ) {
+        setfail( true );
+    }
+
+    _file = nullptr;
+
+    return !fail();
+}
+
+bool ZStreamWriter::_compress( const uint8_t * data, const size_t size, const int flush )
+{
+    if ( !_zstream ) {
+        return false;
+    }
+
+    z_stream & zs = *_zstream;
+    zs.next_in = const_cast<Bytef *>( data );
+    zs.avail_in = static_cast<uInt>( size );
+
+    do {
+        zs.next_out = _output.data();
+        zs.avail_out = static_cast<uInt>( _output.size() );
+
+        const int ret = deflate( &zs, flush );
+        if ( ret == Z_STREAM_ERROR ) {
+            logZlibError( ret );
             return false;
         }
-        const uint32_t size1 = sf.get32(); // zip size
-        if ( size1 == 0 ) {
+
+        const size_t compressedSize = _output.size() - zs.avail_out;
+        if ( compressedSize > 0 && std::fwrite( _output.data(), compressedSize, 1, _file ) != 1 ) {
             return false;
         }
-        sf.skip( 4 ); // old stream format
-        const std::vector<uint8_t> zip = sf.getRaw( size1 );
-        const std::vector<uint8_t> raw = zlibDecompress( &zip[0], zip.size(), size0 );
-        putRaw( reinterpret_cast<const char *>( &raw[0] ), raw.size() );
-        seek( 0 );
-        return !fail();
-    }
-    return false;
+    } while ( zs.avail_out == 0 );
+
+    _rawSize += size;
+
+    return true;
 }
 
-bool ZStreamFile::write( const std::string & fn, bool append ) const
+size_t ZStreamWriter::tellg() const
+{
+    return 0;
+}
+
+size_t ZStreamWriter::sizeg() const
+{
+    return 0;
+}
+
+size_t ZStreamWriter::tellp() const
+{
+    return _rawSize + _input.size();
+}
+
+size_t ZStreamWriter::sizep() const
+{
+    return 0;
+}
+
+uint8_t ZStreamWriter::get8()
 {
-    StreamFile sf;
-    sf.setbigendian( true );
+    setfail( true );
+    return 0u;
+}
 
-    if ( sf.open( fn, append ? "ab" : "wb" ) ) {
-        const std::vector<uint8_t> zip = zlibCompress( data(), size() );
+void ZStreamWriter::put8( const uint8_t v )
+{
+    _input.push_back( v );
 
-        if ( !zip.empty() ) {
-            sf.put32( static_cast<uint32_t>( size() ) );
-            sf.put32( static_cast<uint32_t>( zip.size() ) );
-            sf.put32( 0 ); // unused, old format support
-            sf.putRaw( reinterpret_cast<const char *>( &zip[0] ), zip.size() );
-            return !sf.fail();
+    if ( _input.size() >= zlibChunkSize ) {
+        if ( !_compress( _input.data(), _input.size(), Z_NO_FLUSH ) ) {
+            setfail( true );
         }
+
+        _input.clear();
     }
-    return false;
+}
+
+void ZStreamWriter::skip( size_t /* sz */ )
+{
+    setfail( true );
+}
+
+uint16_t ZStreamWriter::getBE16()
+{
+    setfail( true );
+    return 0;
+}
+
+uint16_t ZStreamWriter::getLE16()
+{
+    setfail( true );
+    return 0;
+}
+
+uint32_t ZStreamWriter::getBE32()
+{
+    setfail( true );
+    return 0;
+}
+
+uint32_t ZStreamWriter::getLE32()
+{
+    setfail( true );
+    return 0;
+}
+
+void ZStreamWriter::putBE32( uint32_t v )
+{
+    putBE16( static_cast<uint16_t>( v >> 16 ) );
+    putBE16( static_cast<uint16_t>( v & 0xFFFF ) );
+}
+
+void ZStreamWriter::putLE32( uint32_t v )
+{
+    putLE16( static_cast<uint16_t>( v & 0xFFFF ) );
+    putLE16( static_cast<uint16_t>( v >> 16 ) );
+}
+
+void ZStreamWriter::putBE16( uint16_t v )
+{
+    put8( static_cast<uint8_t>( v >> 8 ) );
+    put8( static_cast<uint8_t>( v & 0xFF ) );
+}
+
+void ZStreamWriter::putLE16( uint16_t v )
+{
+    put8( static_cast<uint8_t>( v & 0xFF ) );
+    put8( static_cast<uint8_t>( v >> 8 ) );
+}
+
+std::vector<uint8_t> ZStreamWriter::getRaw( size_t /* sz */ )
+{
+    setfail( true );
+    return {};
+}
+
+void ZStreamWriter::putRaw( const char * ptr, size_t sz )
+{
+    if ( sz == 0 ) {
+        return;
+    }
+
+    if ( _input.size() + sz < zlibChunkSize ) {
+        _input.insert( _input.end(), ptr, ptr + sz );
+        return;
+    }
+
+    // Large blocks are compressed directly without copying them into the intermediate buffer.
+    if ( !_compress( _input.data(), _input.size(), Z_NO_FLUSH ) || !_compress( reinterpret_cast<const uint8_t *>( ptr ), sz, Z_NO_FLUSH ) ) {
+        setfail( true );
+    }
+
+    _input.clear();
 }
 
 fheroes2::Image CreateImageFromZlib( int32_t width, int32_t height, const uint8_t * imageData, size_t imageSize, bool doubleLayer )
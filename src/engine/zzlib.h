@@ -26,11 +26,16 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "image.h"
 #include "serialize.h"
 
+struct z_stream_s;
+
 class ZStreamFile : public StreamBuf
 {
 public:
@@ -40,6 +45,119 @@ public:
     bool write( const std::string &, bool append = false ) const;
 };
 
+// Reads data from a compressed file created by ZStreamFile or ZStreamWriter. Data is decompressed on demand in fixed-size chunks
+// so memory usage does not depend on the size of the file.
+class ZStreamReader : public StreamBase
+{
+public:
+    ZStreamReader();
+    ZStreamReader( const ZStreamReader & ) = delete;
+
+    ~ZStreamReader() override;
+
+    ZStreamReader & operator=( const ZStreamReader & ) = delete;
+
+    bool open( const std::string & fileName, const size_t offset = 0 );
+    void close();
+
+    void skip( size_t sz ) override;
+
+    uint16_t getBE16() override;
+    uint16_t getLE16() override;
+    uint32_t getBE32() override;
+    uint32_t getLE32() override;
+
+    // The stream is read-only: all put operations set the fail flag.
+    void putBE32( uint32_t v ) override;
+    void putLE32( uint32_t v ) override;
+    void putBE16( uint16_t v ) override;
+    void putLE16( uint16_t v ) override;
+
+    std::vector<uint8_t> getRaw( size_t sz = 0 /* all data */ ) override;
+    void putRaw( const char * ptr, size_t sz ) override;
+
+protected:
+    size_t sizeg() const override;
+    size_t sizep() const override;
+    size_t tellg() const override;
+    size_t tellp() const override;
+
+    uint8_t get8() override;
+    void put8( const uint8_t v ) override;
+
+private:
+    std::FILE * _file{ nullptr };
+    std::unique_ptr<z_stream_s> _zstream;
+
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _output;
+    size_t _outputPos{ 0 };
+    size_t _outputSize{ 0 };
+
+    size_t _rawSize{ 0 };
+    size_t _compressedSizeLeft{ 0 };
+    bool _isStreamEnd{ false };
+
+    // Decompresses the next chunk of data. Returns false if no more data is available.
+    bool _decompressChunk();
+};
+
+// Writes data into a compressed file in fixed-size chunks so the uncompressed data is never stored in memory in full.
+// The file format is the same as the one used by ZStreamFile.
+class ZStreamWriter : public StreamBase
+{
+public:
+    ZStreamWriter();
+    ZStreamWriter( const ZStreamWriter & ) = delete;
+
+    ~ZStreamWriter() override;
+
+    ZStreamWriter & operator=( const ZStreamWriter & ) = delete;
+
+    // Compression level is in range from 0 (no compression) to 9 (best compression), -1 means zlib's default level.
+    bool open( const std::string & fileName, const bool append, const int compressionLevel = -1 );
+
+    // Compresses all pending data and completes the file. Returns false if any error occurred while writing.
+    bool close();
+
+    // The stream is write-only: all get operations set the fail flag.
+    void skip( size_t sz ) override;
+
+    uint16_t getBE16() override;
+    uint16_t getLE16() override;
+    uint32_t getBE32() override;
+    uint32_t getLE32() override;
+
+    void putBE32( uint32_t v ) override;
+    void putLE32( uint32_t v ) override;
+    void putBE16( uint16_t v ) override;
+    void putLE16( uint16_t v ) override;
+
+    std::vector<uint8_t> getRaw( size_t sz = 0 /* all data */ ) override;
+    void putRaw( const char * ptr, size_t sz ) override;
+
+protected:
+    size_t sizeg() const override;
+    size_t sizep() const override;
+    size_t tellg() const override;
+    size_t tellp() const override;
+
+    uint8_t get8() override;
+    void put8( const uint8_t v ) override;
+
+private:
+    std::FILE * _file{ nullptr };
+    std::unique_ptr<z_stream_s> _zstream;
+
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _output;
+
+    long _headerOffset{ 0 };
+    size_t _rawSize{ 0 };
+
+    bool _compress( const uint8_t * data, const size_t size, const int flush );
+};
+
 fheroes2::Image CreateImageFromZlib( int32_t width, int32_t height, const uint8_t * imageData, size_t imageSize, bool doubleLayer );
 
 #endif
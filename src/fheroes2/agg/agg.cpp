@@ -39,17 +39,31 @@ namespace
 
 std::vector<uint8_t> AGG::getDataFromAggFile( const std::string & key )
 {
-    if ( heroes2x_agg.isGood() ) {
-        // Make sure that the below container is not const and not a reference
-        // so returning it from the function will invoke a move constructor instead of copy constructor.
-        std::vector<uint8_t> buf = heroes2x_agg.read( key );
-        if ( !buf.empty() )
-            return buf;
+    return getDataViewFromAggFile( key ).toVector();
+}
+
+fheroes2::FileData AGG::getDataViewFromAggFile( const std::string & key, const bool ignoreExpansion )
+{
+    if ( !ignoreExpansion && heroes2x_agg.isGood() ) {
+        // Make sure that the below object is not const and not a reference
+        // so returning it from the function will invoke a move constructor.
+        fheroes2::FileData data = heroes2x_agg.read( key );
+        if ( !data.empty() )
+            return data;
     }
 
     return heroes2_agg.read( key );
 }
 
+uint32_t AGG::getAggFilesChecksum()
+{
+    if ( heroes2x_agg.isGood() ) {
+        return heroes2_agg.checksum() ^ ( heroes2x_agg.checksum() << 1 );
+    }
+
+    return heroes2_agg.checksum();
+}
+
 AGG::AGGInitializer::AGGInitializer()
 {
     if ( init() ) {
@@ -94,8 +108,6 @@ bool AGG::AGGInitializer::init()
         return false;
     }
 
-    _originalAGGFilePath = std::move( heroes2AggFilePath );
-
     // Find "heroes2x.agg" file.
     std::string heroes2XAggFilePath;
     fheroes2::replaceStringEnding( aggLowerCaseFilePath, ".agg", "x.agg" );
@@ -108,8 +120,8 @@ bool AGG::AGGInitializer::init()
         }
     }
 
-    if ( !heroes2XAggFilePath.empty() && heroes2x_agg.open( heroes2XAggFilePath ) ) {
-        _expansionAGGFilePath = std::move( heroes2XAggFilePath );
+    if ( !heroes2XAggFilePath.empty() ) {
+        heroes2x_agg.open( heroes2XAggFilePath );
     }
 
     Settings::Get().EnablePriceOfLoyaltySupport( heroes2x_agg.isGood() );
@@ -28,6 +28,8 @@
 #include <string>
 #include <vector>
 
+#include "mapped_file.h"
+
 namespace AGG
 {
     class AGGInitializer
@@ -39,24 +41,19 @@ namespace AGG
 
         ~AGGInitializer() = default;
 
-        const std::string & getOriginalAGGFilePath() const
-        {
-            return _originalAGGFilePath;
-        }
-
-        const std::string & getExpansionAGGFilePath() const
-        {
-            return _expansionAGGFilePath;
-        }
-
     private:
-        bool init();
-
-        std::string _originalAGGFilePath;
-        std::string _expansionAGGFilePath;
+        static bool init();
     };
 
+    // All functions below are thread-safe: AGG files are read-only after initialization and support concurrent reads.
     std::vector<uint8_t> getDataFromAggFile( const std::string & key );
+
+    // Returns resource data without copying it when the AGG file is memory mapped. The returned object is valid until AGG files are closed.
+    // If ignoreExpansion is true the resource is looked up only in the original HEROES2.AGG file.
+    fheroes2::FileData getDataViewFromAggFile( const std::string & key, const bool ignoreExpansion = false );
+
+    // Returns a value which identifies the combination of currently used AGG files.
+    uint32_t getAggFilesChecksum();
 }
 
 #endif
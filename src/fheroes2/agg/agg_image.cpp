@@ -34,15 +34,19 @@
 #include "agg.h"
 #include "agg_file.h"
 #include "agg_image.h"
+#include "agg_image_cache.h"
 #include "h2d.h"
 #include "icn.h"
 #include "image.h"
 #include "image_tool.h"
+#include "logging.h"
 #include "math_base.h"
 #include "pal.h"
 #include "rand.h"
 #include "screen.h"
 #include "serialize.h"
+#include "settings.h"
+#include "system.h"
 #include "text.h"
 #include "til.h"
 #include "tools.h"
@@ -63,6 +67,8 @@ namespace
 
     std::map<int, std::vector<fheroes2::Sprite>> _icnVsScaledSprite;
 
+    uint32_t fontResourceVersion = 0;
+
     // Some resources are language dependent. These are mostly buttons with a text of them.
     // Once a user changes a language we have to update resources. To do this we need to clear the existing images.
     const std::set<int> languageDependentIcnId{ ICN::BTNBATTLEONLY,
@@ -77,6 +83,24 @@ namespace
                                                 ICN::BUTTON_DIFFICULTY_ROLAND,
                                                 ICN::BUTTON_DIFFICULTY_POL };
 
+    // Images which cannot be stored in the sprite disk cache: they depend on the game language or are generated together with other images.
+    const std::set<int> nonCacheableIcnId{ ICN::FONT,
+                                           ICN::SMALFONT,
+                                           ICN::YELLOW_FONT,
+                                           ICN::YELLOW_SMALLFONT,
+                                           ICN::GRAY_FONT,
+                                           ICN::GRAY_SMALL_FONT,
+                                           ICN::WHITE_LARGE_FONT,
+                                           ICN::BUTTON_GOOD_FONT_RELEASED,
+                                           ICN::BUTTON_GOOD_FONT_PRESSED,
+                                           ICN::BUTTON_EVIL_FONT_RELEASED,
+                                           ICN::BUTTON_EVIL_FONT_PRESSED,
+                                           ICN::MINI_MONSTER_IMAGE,
+                                           ICN::MINI_MONSTER_SHADOW };
+
+    fheroes2::AGG::ICNPreloader icnPreloader;
+    fheroes2::AGG::SpriteDiskCache spriteDiskCache;
+
 #ifndef NDEBUG
     bool isLanguageDependentIcnId( const int id )
     {
@@ -84,6 +108,21 @@ namespace
     }
 #endif
 
+    bool isCacheableIcnId( const int id )
+    {
+        return languageDependentIcnId.count( id ) == 0 && nonCacheableIcnId.count( id ) == 0;
+    }
+
+    std::string getIcnCacheEntryName( const int id )
+    {
+        return std::string( "icn." ) + ICN::GetString( id );
+    }
+
+    std::string getAlphabetCacheEntryName( const fheroes2::SupportedLanguage language, const int id )
+    {
+        return std::string( "alphabet." ) + fheroes2::getLanguageAbbreviation( language ) + '.' + ICN::GetString( id );
+    }
+
     bool IsValidICNId( int id )
     {
         return id >= 0 && static_cast<size_t>( id ) < _icnVsSprite.size();
@@ -151,13 +190,13 @@ namespace
     // BMP files within AGG are not Bitmap files.
     fheroes2::Sprite loadBMPFile( const std::string & path )
     {
-        const std::vector<uint8_t> & data = AGG::getDataFromAggFile( path );
+        const fheroes2::FileData data = AGG::getDataViewFromAggFile( path );
         if ( data.size() < 6 ) {
             // It is an invalid BMP file.
             return {};
         }
 
-        StreamBuf imageStream( data );
+        StreamBuf imageStream( data.data(), data.size() );
 
         const uint8_t blackColor = imageStream.get();
 
@@ -427,43 +466,12 @@ namespace fheroes2
     {
         void LoadOriginalICN( int id )
         {
-            const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::GetString( id ) );
-
-            if ( body.empty() ) {
-                return;
-            }
-
-            StreamBuf imageStream( body );
-
-            const uint32_t count = imageStream.getLE16();
-            const uint32_t blockSize = imageStream.getLE32();
-            if ( count == 0 || blockSize == 0 ) {
+            if ( icnPreloader.take( id, _icnVsSprite[id] ) ) {
                 return;
             }
 
-            _icnVsSprite[id].resize( count );
-
-            for ( uint32_t i = 0; i < count; ++i ) {
-                imageStream.seek( headerSize + i * 13 );
-
-                ICNHeader header1;
-                imageStream >> header1;
-
-                uint32_t sizeData = 0;
-                if ( i + 1 != count ) {
-                    ICNHeader header2;
-                    imageStream >> header2;
-                    sizeData = header2.offsetData - header1.offsetData;
-                }
-                else {
-                    sizeData = blockSize - header1.offsetData;
-                }
-
-                const uint8_t * data = body.data() + headerSize + header1.offsetData;
-
-                _icnVsSprite[id][i]
-                    = decodeICNSprite( data, sizeData, header1.width, header1.height, static_cast<int16_t>( header1.offsetX ), static_cast<int16_t>( header1.offsetY ) );
-            }
+            const FileData body = ::AGG::getDataViewFromAggFile( ICN::GetString( id ) );
+            _icnVsSprite[id] = decodeICN( body.data(), body.size() );
         }
 
         // Helper function for LoadModifiedICN
@@ -934,7 +942,7 @@ namespace fheroes2
 
                 if ( id == ICN::SMALFONT ) {
                     // Small font in official Polish GoG version has all letters to be shifted by 1 pixel lower.
-                    const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::GetString( id ) );
+                    const FileData body = ::AGG::getDataViewFromAggFile( ICN::GetString( id ) );
                     const uint32_t crc32 = fheroes2::calculateCRC32( body.data(), body.size() );
                     if ( crc32 == 0xE9EC7A63 ) {
                         for ( Sprite & letter : imageArray ) {
@@ -2386,7 +2394,21 @@ namespace fheroes2
 
         size_t GetMaximumICNIndex( int id )
         {
-            if ( _icnVsSprite[id].empty() && !LoadModifiedICN( id ) ) {
+            if ( !_icnVsSprite[id].empty() ) {
+                return _icnVsSprite[id].size();
+            }
+
+            const bool isCacheable = isCacheableIcnId( id );
+            if ( isCacheable && spriteDiskCache.load( getIcnCacheEntryName( id ), _icnVsSprite[id] ) ) {
+                return _icnVsSprite[id].size();
+            }
+
+            if ( LoadModifiedICN( id ) ) {
+                if ( isCacheable ) {
+                    spriteDiskCache.store( getIcnCacheEntryName( id ), _icnVsSprite[id] );
+                }
+            }
+            else {
                 LoadOriginalICN( id );
             }
 
@@ -2398,14 +2420,14 @@ namespace fheroes2
             if ( _tilVsImage[id].empty() ) {
                 _tilVsImage[id].resize( 4 ); // 4 possible sides
 
-                const std::vector<uint8_t> & data = ::AGG::getDataFromAggFile( tilFileName[id] );
+                const FileData data = ::AGG::getDataViewFromAggFile( tilFileName[id] );
                 if ( data.size() < headerSize ) {
                     // The important resource is absent! Make sure that you are using the correct version of the game.
                     assert( 0 );
                     return 0;
                 }
 
-                StreamBuf buffer( data );
+                StreamBuf buffer( data.data(), data.size() );
 
                 const uint32_t count = buffer.getLE16();
                 const uint32_t width = buffer.getLE16();
@@ -2688,7 +2710,27 @@ namespace fheroes2
                 alphabetPreserver.preserve();
                 // Restore original letters when changing language to avoid changes to them being carried over.
                 alphabetPreserver.restore();
-                generateAlphabet( language, _icnVsSprite );
+
+                std::vector<Sprite> normalFont;
+                std::vector<Sprite> smallFont;
+                if ( spriteDiskCache.load( getAlphabetCacheEntryName( language, ICN::FONT ), normalFont )
+                     && spriteDiskCache.load( getAlphabetCacheEntryName( language, ICN::SMALFONT ), smallFont ) ) {
+                    _icnVsSprite[ICN::FONT] = std::move( normalFont );
+                    _icnVsSprite[ICN::SMALFONT] = std::move( smallFont );
+
+                    // Derived fonts must be regenerated from the new alphabet.
+                    _icnVsSprite[ICN::YELLOW_FONT].clear();
+                    _icnVsSprite[ICN::YELLOW_SMALLFONT].clear();
+                    _icnVsSprite[ICN::GRAY_FONT].clear();
+                    _icnVsSprite[ICN::GRAY_SMALL_FONT].clear();
+                    _icnVsSprite[ICN::WHITE_LARGE_FONT].clear();
+                }
+                else {
+                    generateAlphabet( language, _icnVsSprite );
+
+                    spriteDiskCache.store( getAlphabetCacheEntryName( language, ICN::FONT ), _icnVsSprite[ICN::FONT] );
+                    spriteDiskCache.store( getAlphabetCacheEntryName( language, ICN::SMALFONT ), _icnVsSprite[ICN::SMALFONT] );
+                }
             }
             generateButtonAlphabet( language, _icnVsSprite );
 
@@ -2696,6 +2738,49 @@ namespace fheroes2
             for ( const int id : languageDependentIcnId ) {
                 _icnVsSprite[id].clear();
             }
+
+            ++fontResourceVersion;
+        }
+
+        uint32_t getFontResourceVersion()
+        {
+            return fontResourceVersion;
+        }
+
+        void preloadICNs( const std::vector<int> & icnIds )
+        {
+            if ( !Settings::Get().isResourcePreloadingEnabled() ) {
+                return;
+            }
+
+            std::vector<int> notLoadedIcnIds;
+            notLoadedIcnIds.reserve( icnIds.size() );
+
+            for ( const int id : icnIds ) {
+                if ( IsValidICNId( id ) && _icnVsSprite[id].empty() ) {
+                    notLoadedIcnIds.emplace_back( id );
+                }
+            }
+
+            icnPreloader.start( notLoadedIcnIds );
+        }
+
+        ICNCacheInitializer::ICNCacheInitializer()
+        {
+            if ( !Settings::Get().isSpriteDiskCacheEnabled() ) {
+                return;
+            }
+
+            const std::string path = System::concatPath( System::GetConfigDirectory( "fheroes2" ), "sprite_cache.h2d" );
+            if ( spriteDiskCache.open( path, Settings::GetVersion(), ::AGG::getAggFilesChecksum() ) ) {
+                DEBUG_LOG( DBG_ENGINE, DBG_INFO, "Sprite cache is loaded from " << path )
+            }
+        }
+
+        ICNCacheInitializer::~ICNCacheInitializer()
+        {
+            icnPreloader.stop();
+            spriteDiskCache.close();
         }
     }
 }
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 namespace fheroes2
 {
@@ -49,5 +50,22 @@ namespace fheroes2
 
         // This function must be called only at the type of setting up a new language.
         void updateLanguageDependentResources( const SupportedLanguage language, const bool loadOriginalAlphabet );
+
+        // Returns a number which changes every time font images are updated, for example, after a language change.
+        uint32_t getFontResourceVersion();
+
+        // Decode the given ICNs in background threads. The decoded images are picked up on the first request of the corresponding ICN.
+        void preloadICNs( const std::vector<int> & icnIds );
+
+        // Manages the lifetime of ICN preloading threads and sprite disk cache. It must be created after AGG and H2D files are initialized.
+        class ICNCacheInitializer
+        {
+        public:
+            ICNCacheInitializer();
+            ICNCacheInitializer( const ICNCacheInitializer & ) = delete;
+            ICNCacheInitializer & operator=( const ICNCacheInitializer & ) = delete;
+
+            ~ICNCacheInitializer();
+        };
     }
 }
@@ -0,0 +1,455 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2022                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "agg_image_cache.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "agg.h"
+#include "agg_file.h"
+#include "icn.h"
+#include "image.h"
+#include "image_tool.h"
+#include "logging.h"
+#include "serialize.h"
+#include "thread.h"
+
+namespace
+{
+    const uint32_t icnHeaderSize = 6;
+
+    const std::string cacheInfoEntryName( "cache.info" );
+
+    // Worker threads are used only to hide ICN decoding time behind user interaction. There is no reason to occupy all CPU cores for it.
+    const size_t maxPreloadingThreads = 4;
+
+    std::vector<uint8_t> serializeSprites( const std::vector<fheroes2::Sprite> & sprites )
+    {
+        size_t totalSize = 4;
+        for ( const fheroes2::Sprite & sprite : sprites ) {
+            totalSize += 4 * 4 + 1 + static_cast<size_t>( sprite.width() ) * static_cast<size_t>( sprite.height() ) * 2;
+        }
+
+        StreamBuf stream( totalSize );
+        stream.putLE32( static_cast<uint32_t>( sprites.size() ) );
+
+        for ( const fheroes2::Sprite & sprite : sprites ) {
+            stream.putLE32( static_cast<uint32_t>( sprite.width() ) );
+            stream.putLE32( static_cast<uint32_t>( sprite.height() ) );
+            stream.putLE32( static_cast<uint32_t>( sprite.x() ) );
+            stream.putLE32( static_cast<uint32_t>( sprite.y() ) );
+            stream.put( sprite.singleLayer() ? 1 : 0 );
+
+            if ( sprite.empty() ) {
+                continue;
+            }
+
+            const size_t imageSize = static_cast<size_t>( sprite.width() ) * static_cast<size_t>( sprite.height() );
+            stream.putRaw( reinterpret_cast<const char *>( sprite.image() ), imageSize );
+            stream.putRaw( reinterpret_cast<const char *>( sprite.transform() ), imageSize );
+        }
+
+        return stream.getRaw();
+    }
+
+    bool deserializeSprites( const fheroes2::FileData & data, std::vector<fheroes2::Sprite> & sprites )
+    {
+        if ( data.size() < 4 ) {
+            return false;
+        }
+
+        StreamBuf stream( data.data(), data.size() );
+
+        const uint32_t count = stream.getLE32();
+
+        // Empty entries are never stored so such an entry is corrupted. Also each sprite record takes at least 17 bytes: 4 header fields and the layer flag.
+        // Check the number of sprites before allocating memory for them as a corrupted cache file may contain any value here.
+        if ( count == 0 || count > ( data.size() - 4 ) / ( 4 * 4 + 1 ) ) {
+            return false;
+        }
+
+        std::vector<fheroes2::Sprite> output( count );
+
+        size_t offset = 4;
+
+        for ( fheroes2::Sprite & sprite : output ) {
+            if ( offset + 4 * 4 + 1 > data.size() ) {
+                return false;
+            }
+
+            const int32_t width = static_cast<int32_t>( stream.getLE32() );
+            const int32_t height = static_cast<int32_t>( stream.getLE32() );
+            const int32_t x = static_cast<int32_t>( stream.getLE32() );
+            const int32_t y = static_cast<int32_t>( stream.getLE32() );
+            const bool isSingleLayer = stream.get() != 0;
+
+            offset += 4 * 4 + 1;
+
+            if ( width < 0 || height < 0 ) {
+                return false;
+            }
+
+            const size_t imageSize = static_cast<size_t>( width ) * static_cast<size_t>( height );
+            if ( imageSize == 0 ) {
+                sprite.setPosition( x, y );
+                continue;
+            }
+
+            if ( offset + imageSize * 2 > data.size() ) {
+                return false;
+            }
+
+            sprite.resize( width, height );
+            sprite.setPosition( x, y );
+
+            memcpy( sprite.image(), data.data() + offset, imageSize );
+            memcpy( sprite.transform(), data.data() + offset + imageSize, imageSize );
+
+            if ( isSingleLayer ) {
+                sprite._disableTransformLayer();
+            }
+
+            offset += imageSize * 2;
+            stream.skip( imageSize * 2 );
+        }
+
+        sprites = std::move( output );
+
+        return true;
+    }
+
+    std::vector<fheroes2::Sprite> loadICN( const int icnId )
+    {
+        // AGG files support concurrent reads so this function can be called from any thread.
+        const fheroes2::FileData body = AGG::getDataViewFromAggFile( ICN::GetString( icnId ) );
+
+        return fheroes2::AGG::decodeICN( body.data(), body.size() );
+    }
+}
+
+namespace fheroes2
+{
+    namespace AGG
+    {
+        std::vector<Sprite> decodeICN( const uint8_t * data, const size_t size )
+        {
+            if ( size < icnHeaderSize ) {
+                return {};
+            }
+
+            StreamBuf imageStream( data, size );
+
+            const uint32_t count = imageStream.getLE16();
+            const uint32_t blockSize = imageStream.getLE32();
+            if ( count == 0 || blockSize == 0 ) {
+                return {};
+            }
+
+            std::vector<Sprite> sprites( count );
+
+            for ( uint32_t i = 0; i < count; ++i ) {
+                imageStream.seek( icnHeaderSize + i * 13 );
+
+                ICNHeader header1;
+                imageStream >> header1;
+
+                uint32_t sizeData = 0;
+                if ( i + 1 != count ) {
+                    ICNHeader header2;
+                    imageStream >> header2;
+                    sizeData = header2.offsetData - header1.offsetData;
+                }
+                else {
+                    sizeData = blockSize - header1.offsetData;
+                }
+
+                sprites[i] = decodeICNSprite( data + icnHeaderSize + header1.offsetData, sizeData, header1.width, header1.height, static_cast<int16_t>( header1.offsetX ),
+                                              static_cast<int16_t>( header1.offsetY ) );
+            }
+
+            return sprites;
+        }
+
+        // Every worker has its own queue of ICN files. Results are kept until they are taken by the main thread.
+        class ICNPreloader::Worker final : public MultiThreading::AsyncManager
+        {
+        public:
+            void add( const std::vector<int> & icnIds )
+            {
+                createWorker();
+
+                std::scoped_lock<std::mutex> lock( _mutex );
+
+                for ( const int icnId : icnIds ) {
+                    if ( _tasks.try_emplace( icnId ).second ) {
+                        _queue.emplace_back( icnId );
+                    }
+                }
+
+                notifyWorker();
+            }
+
+            bool take( const int icnId, std::vector<Sprite> & sprites )
+            {
+                std::unique_lock<std::mutex> lock( _mutex );
+
+                auto iter = _tasks.find( icnId );
+                if ( iter == _tasks.end() ) {
+                    return false;
+                }
+
+                Task & task = iter->second;
+
+                if ( task.status == TaskStatus::QUEUED ) {
+                    // No need to wait for the worker thread. Load the file right now.
+                    _queue.erase( std::find( _queue.begin(), _queue.end(), icnId ) );
+                    _tasks.erase( iter );
+
+                    lock.unlock();
+
+                    sprites = loadICN( icnId );
+                    return true;
+                }
+
+                _taskDone.wait( lock, [&task]() { return task.status == TaskStatus::DONE; } );
+
+                sprites = std::move( task.sprites );
+                _tasks.erase( iter );
+
+                return true;
+            }
+
+        private:
+            enum class TaskStatus : int
+            {
+                QUEUED,
+                IN_PROGRESS,
+                DONE
+            };
+
+            struct Task
+            {
+                std::vector<Sprite> sprites;
+                TaskStatus status{ TaskStatus::QUEUED };
+            };
+
+            std::condition_variable _taskDone;
+
+            std::map<int, Task> _tasks;
+            std::deque<int> _queue;
+
+            // ICN which is being loaded by the worker thread, -1 if there is no such ICN. It is accessed only by the worker thread.
+            int _currentIcnId{ -1 };
+
+            bool prepareTask() override
+            {
+                // The queue might have been emptied by the main thread which loaded the files by itself.
+                if ( _queue.empty() ) {
+                    _currentIcnId = -1;
+                    return false;
+                }
+
+                _currentIcnId = _queue.front();
+                _queue.pop_front();
+
+                auto iter = _tasks.find( _currentIcnId );
+                assert( iter != _tasks.end() && iter->second.status == TaskStatus::QUEUED );
+
+                iter->second.status = TaskStatus::IN_PROGRESS;
+
+                return !_queue.empty();
+            }
+
+            void executeTask() override
+            {
+                if ( _currentIcnId < 0 ) {
+                    return;
+                }
+
+                std::vector<Sprite> sprites = loadICN( _currentIcnId );
+
+                {
+                    std::scoped_lock<std::mutex> lock( _mutex );
+
+                    // The task cannot be removed by the main thread until it is done.
+                    auto iter = _tasks.find( _currentIcnId );
+                    assert( iter != _tasks.end() && iter->second.status == TaskStatus::IN_PROGRESS );
+
+                    iter->second.sprites = std::move( sprites );
+                    iter->second.status = TaskStatus::DONE;
+                }
+
+                _taskDone.notify_all();
+            }
+        };
+
+        ICNPreloader::ICNPreloader() = default;
+
+        ICNPreloader::~ICNPreloader()
+        {
+            // The worker threads cannot be stopped here due to the potential race on the vptr of the workers.
+            assert( _workers.empty() );
+        }
+
+        void ICNPreloader::start( const std::vector<int> & icnIds )
+        {
+            if ( _isStopped ) {
+                return;
+            }
+
+            if ( _workers.empty() ) {
+                const size_t threadCount
+                    = std::clamp( static_cast<size_t>( std::thread::hardware_concurrency() ), static_cast<size_t>( 2 ), maxPreloadingThreads + 1 ) - 1;
+
+                for ( size_t i = 0; i < threadCount; ++i ) {
+                    _workers.emplace_back( std::make_unique<Worker>() );
+                }
+            }
+
+            // Files are distributed between the workers in turns, so they are loaded roughly in the order of the request.
+            std::vector<std::vector<int>> workerIcnIds( _workers.size() );
+
+            for ( const int icnId : icnIds ) {
+                if ( _icnWorkers.count( icnId ) > 0 ) {
+                    continue;
+                }
+
+                _icnWorkers.emplace( icnId, _workers[_nextWorkerId].get() );
+                workerIcnIds[_nextWorkerId].emplace_back( icnId );
+
+                _nextWorkerId = ( _nextWorkerId + 1 ) % _workers.size();
+            }
+
+            for ( size_t i = 0; i < _workers.size(); ++i ) {
+                if ( !workerIcnIds[i].empty() ) {
+                    _workers[i]->add( workerIcnIds[i] );
+                }
+            }
+        }
+
+        bool ICNPreloader::take( const int icnId, std::vector<Sprite> & sprites )
+        {
+            const auto iter = _icnWorkers.find( icnId );
+            if ( iter == _icnWorkers.end() ) {
+                return false;
+            }
+
+            Worker * worker = iter->second;
+            _icnWorkers.erase( iter );
+
+            return worker->take( icnId, sprites );
+        }
+
+        void ICNPreloader::stop()
+        {
+            for ( const std::unique_ptr<Worker> & worker : _workers ) {
+                worker->stopWorker();
+            }
+
+            _workers.clear();
+            _icnWorkers.clear();
+
+            _isStopped = true;
+        }
+
+        bool SpriteDiskCache::open( const std::string & path, const std::string & gameVersion, const uint32_t dataChecksum )
+        {
+            close();
+
+            _path = path;
+            _versionInfo = gameVersion + ':' + std::to_string( dataChecksum );
+
+            std::unique_ptr<H2RReader> reader = std::make_unique<H2RReader>();
+            if ( !reader->open( path ) ) {
+                DEBUG_LOG( DBG_ENGINE, DBG_INFO, "Sprite cache " << path << " does not exist or is corrupted." )
+                return false;
+            }
+
+            const std::vector<uint8_t> info = reader->getFile( cacheInfoEntryName );
+            if ( std::string( info.begin(), info.end() ) != _versionInfo ) {
+                DEBUG_LOG( DBG_ENGINE, DBG_INFO, "Sprite cache " << path << " is outdated and is going to be rebuilt." )
+                // Outdated content must be completely replaced.
+                _isModified = true;
+                return false;
+            }
+
+            _reader = std::move( reader );
+
+            return true;
+        }
+
+        bool SpriteDiskCache::load( const std::string & name, std::vector<Sprite> & sprites )
+        {
+            if ( !_reader ) {
+                return false;
+            }
+
+            return deserializeSprites( _reader->getFileData( name ), sprites );
+        }
+
+        void SpriteDiskCache::store( const std::string & name, const std::vector<Sprite> & sprites )
+        {
+            if ( !isOpen() || sprites.empty() ) {
+                return;
+            }
+
+            if ( _newEntries.try_emplace( name, serializeSprites( sprites ) ).second ) {
+                _isModified = true;
+            }
+        }
+
+        void SpriteDiskCache::close()
+        {
+            if ( isOpen() && _isModified ) {
+                H2Writer writer;
+                writer.add( cacheInfoEntryName, std::vector<uint8_t>( _versionInfo.begin(), _versionInfo.end() ) );
+
+                if ( _reader ) {
+                    for ( const std::string & name : _reader->getAllFileNames() ) {
+                        writer.add( name, _reader->getFile( name ) );
+                    }
+
+                    // The file must be closed before being overwritten.
+                    _reader.reset();
+                }
+
+                for ( const auto & [name, data] : _newEntries ) {
+                    writer.add( name, data );
+                }
+
+                if ( !writer.write( _path ) ) {
+                    ERROR_LOG( "Failed to write sprite cache to " << _path )
+                }
+            }
+
+            _path.clear();
+            _versionInfo.clear();
+            _reader.reset();
+            _newEntries.clear();
+            _isModified = false;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2022                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "h2d_file.h"
+
+namespace fheroes2
+{
+    class Sprite;
+
+    namespace AGG
+    {
+        // Decodes all frames of an ICN file. The function does not access any shared data so it can be called from any thread.
+        std::vector<Sprite> decodeICN( const uint8_t * data, const size_t size );
+
+        // Loads and decodes ICN files using several worker threads. All methods must be called from the main thread.
+        class ICNPreloader
+        {
+        public:
+            ICNPreloader();
+            ICNPreloader( const ICNPreloader & ) = delete;
+
+            // Worker threads must be stopped by calling stop() before the destruction.
+            ~ICNPreloader();
+
+            ICNPreloader & operator=( const ICNPreloader & ) = delete;
+
+            // Queue ICN files for loading and start worker threads if needed.
+            void start( const std::vector<int> & icnIds );
+
+            // Move decoded frames of the ICN into the given container. If the ICN is still waiting in the queue it is decoded by the calling thread.
+            // If a worker thread is decoding it at the moment this call waits for the result. Returns false if the ICN has never been queued.
+            bool take( const int icnId, std::vector<Sprite> & sprites );
+
+            // Stop and join all worker threads. All unclaimed results are discarded and no more files can be queued.
+            void stop();
+
+        private:
+            class Worker;
+
+            std::vector<std::unique_ptr<Worker>> _workers;
+
+            // Worker which is responsible for every queued ICN.
+            std::map<int, Worker *> _icnWorkers;
+
+            size_t _nextWorkerId{ 0 };
+            bool _isStopped{ false };
+        };
+
+        // Storage of generated and modified images on a disk. Its content is tied to the game version and to the AGG files used to create images.
+        // The cache is not thread-safe and must be accessed only from the main thread.
+        class SpriteDiskCache
+        {
+        public:
+            // Returns false if the cache file does not exist or it was created for another version of the game or resources. In this case the cache is empty
+            // but new entries can still be added and saved.
+            bool open( const std::string & path, const std::string & gameVersion, const uint32_t dataChecksum );
+
+            bool isOpen() const
+            {
+                return !_path.empty();
+            }
+
+            bool load( const std::string & name, std::vector<Sprite> & sprites );
+
+            void store( const std::string & name, const std::vector<Sprite> & sprites );
+
+            // Write the cache to the disk if new entries have been added and close it.
+            void close();
+
+        private:
+            std::string _path;
+            std::string _versionInfo;
+
+            std::unique_ptr<H2RReader> _reader;
+            std::map<std::string, std::vector<uint8_t>> _newEntries;
+            bool _isModified{ false };
+        };
+    }
+}
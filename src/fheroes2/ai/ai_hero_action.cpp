@@ -213,6 +213,26 @@ namespace
 
         return true;
     }
+
+#if defined( WITH_DEBUG )
+    bool regainControlFromAI( const Heroes & hero )
+    {
+        if ( !HotKeyPressEvent( Game::HotKeyEvent::TRANSFER_CONTROL_TO_AI ) || !Players::Get( hero.GetColor() )->isAIAutoControlMode() ) {
+            return false;
+        }
+
+        if ( fheroes2::showMessage( fheroes2::Text( _( "Warning" ), fheroes2::FontType::normalYellow() ),
+                                    fheroes2::Text( _( "Do you want to regain control from AI? The effect will take place only on the next turn." ),
+                                                    fheroes2::FontType::normalWhite() ),
+                                    Dialog::YES | Dialog::NO )
+             != Dialog::YES ) {
+            return false;
+        }
+
+        Players::Get( hero.GetColor() )->setAIAutoControlMode( false );
+        return true;
+    }
+#endif
 }
 
 namespace AI
@@ -1684,11 +1704,37 @@ namespace AI
         if ( path.isValid() ) {
             hero.SetMove( true );
 
+            const Settings & conf = Settings::Get();
+
+            if ( conf.AIMoveSpeed() == 0 ) {
+                // AI movements are not shown so the whole path is passed at once. Game events are processed only once per path instead of
+                // after every step as there is nothing to render. The hero goes through exactly the same steps as with the animated movement.
+                if ( !LocalEvent::Get().HandleEvents( false ) ) {
+                    hero.SetMove( false );
+                    return;
+                }
+
+#if defined( WITH_DEBUG )
+                regainControlFromAI( hero );
+#endif
+
+                while ( !hero.isFreeman() && hero.isMoveEnabled() ) {
+                    hero.Move( true );
+
+                    if ( Game::validateAnimationDelay( Game::MAPS_DELAY ) ) {
+                        // will be animated in hero loop
+                        uint32_t & frame = Game::MapsAnimationFrame();
+                        ++frame;
+                    }
+                }
+
+                hero.SetMove( false );
+                return;
+            }
+
             Interface::Basic & basicInterface = Interface::Basic::Get();
             Interface::GameArea & gameArea = basicInterface.GetGameArea();
 
-            const Settings & conf = Settings::Get();
-
             const uint32_t colors = AIGetAllianceColors();
             bool recenterNeeded = true;
 
@@ -1696,22 +1742,14 @@ namespace AI
             fheroes2::Point heroAnimationOffset;
             int heroAnimationSpriteId = 0;
 
-            const bool hideAIMovements = ( conf.AIMoveSpeed() == 0 );
             const bool noMovementAnimation = ( conf.AIMoveSpeed() == 10 );
 
             const std::vector<Game::DelayType> delayTypes = { Game::CURRENT_AI_DELAY };
 
-            while ( LocalEvent::Get().HandleEvents( !hideAIMovements && Game::isDelayNeeded( delayTypes ) ) ) {
+            while ( LocalEvent::Get().HandleEvents( Game::isDelayNeeded( delayTypes ) ) ) {
 #if defined( WITH_DEBUG )
-                if ( HotKeyPressEvent( Game::HotKeyEvent::TRANSFER_CONTROL_TO_AI ) && Players::Get( hero.GetColor() )->isAIAutoControlMode() ) {
-                    if ( fheroes2::showMessage( fheroes2::Text( _( "Warning" ), fheroes2::FontType::normalYellow() ),
-                                                fheroes2::Text( _( "Do you want to regain control from AI? The effect will take place only on the next turn." ),
-                                                                fheroes2::FontType::normalWhite() ),
-                                                Dialog::YES | Dialog::NO )
-                         == Dialog::YES ) {
-                        Players::Get( hero.GetColor() )->setAIAutoControlMode( false );
-                        continue;
-                    }
+                if ( regainControlFromAI( hero ) ) {
+                    continue;
                 }
 #endif
 
@@ -1719,7 +1757,7 @@ namespace AI
                     break;
                 }
 
-                if ( hideAIMovements || !AIHeroesShowAnimation( hero, colors ) ) {
+                if ( !AIHeroesShowAnimation( hero, colors ) ) {
                     hero.Move( true );
                     recenterNeeded = true;
                 }
@@ -231,8 +231,6 @@ namespace AI
 
         void battleBegins() override;
 
-        double getTargetArmyStrength( const Maps::Tiles & tile, const MP2::MapObjectType objectType );
-
         bool isCriticalTask( const int index ) const
         {
             return _priorityTargets.find( index ) != _priorityTargets.end();
@@ -247,10 +245,6 @@ namespace AI
         AIWorldPathfinder _pathfinder;
         BattlePlanner _battlePlanner;
 
-        // Monster strength is constant over the same turn for AI but its calculation is a heavy operation.
-        // In order to avoid extra computations during AI turn it is important to keep cache of monster strength but update it when an action on a monster is taken.
-        std::map<int32_t, double> _neutralMonsterStrengthCache;
-
         void CastleTurn( Castle & castle, bool defensive );
         bool HeroesTurn( VecHeroes & heroes );
 
@@ -261,11 +255,6 @@ namespace AI
 
         bool purchaseNewHeroes( const std::vector<AICastle> & sortedCastleList, const std::set<int> & castlesInDanger, int32_t availableHeroCount,
                                 bool moreTasksForHeroes );
-
-        static bool isMonsterStrengthCacheable( const MP2::MapObjectType objectType )
-        {
-            return objectType == MP2::OBJ_MONSTER;
-        }
     };
 }
 
@@ -92,7 +92,7 @@ namespace AI
     {
         MeleeAttackOutcome bestOutcome;
 
-        Indexes around = Board::GetAroundIndexes( defender );
+        AroundIndexes around = Board::GetAroundIndexes( defender );
         // Shuffle to make equal quality moves a bit unpredictable
         randomGenerator.Shuffle( around );
 
@@ -585,7 +585,7 @@ namespace AI
 
                 if ( currentUnit.isAbilityPresent( fheroes2::MonsterAbilityType::AREA_SHOT ) ) {
                     // TODO: update logic to handle tail case as well. Right now archers always shoot to head.
-                    const Indexes around = Board::GetAroundIndexes( enemy->GetHeadIndex() );
+                    const AroundIndexes around = Board::GetAroundIndexes( enemy->GetHeadIndex() );
                     std::set<const Unit *> targetedUnits;
 
                     for ( const int32_t cellId : around ) {
@@ -813,7 +813,7 @@ namespace AI
         }
 
         BattleTargetPair targetInfo;
-        std::map<const Unit *, Indexes> aroundIndexesCache;
+        std::map<const Unit *, AroundIndexes> aroundIndexesCache;
 
         // First, try to find a unit nearby that can be attacked on this turn
         for ( const Unit * nearbyUnit : nearestUnits ) {
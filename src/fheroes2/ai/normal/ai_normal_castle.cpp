@@ -20,11 +20,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 #include "ai.h"
 #include "ai_normal.h"
 #include "castle.h"
+#include "difficulty.h"
+#include "game.h"
 #include "kingdom.h"
 #include "maps_tiles.h"
 #include "payment.h"
@@ -129,13 +132,52 @@ namespace AI
         return genericBuildOrder;
     }
 
-    bool Build( Castle & castle, const std::vector<BuildOrder> & buildOrderList, int multiplier = 1 )
+    // Returns true if purchasing the building leaves enough resources for the building which the kingdom is saving for.
+    bool isBuildingAffordableWithSavings( const Castle & castle, const int building, const std::optional<Funds> & reservedFunds )
+    {
+        if ( !reservedFunds ) {
+            return true;
+        }
+
+        return castle.GetKingdom().GetFunds() - PaymentConditions::BuyBuilding( castle.GetRace(), building ) >= *reservedFunds;
+    }
+
+    // Returns the resources to be kept in the treasury if the building lacks only resources and the kingdom income is enough to buy it within the planning period.
+    std::optional<Funds> getReservedFundsForBuilding( const Castle & castle, const int building )
+    {
+        const uint32_t planningDays = Difficulty::GetAIBuildingPlanningDays( Game::getDifficulty() );
+        if ( planningDays == 0 || castle.CheckBuyBuilding( building ) != LACK_RESOURCES ) {
+            return {};
+        }
+
+        const Kingdom & kingdom = castle.GetKingdom();
+        const Funds cost = PaymentConditions::BuyBuilding( castle.GetRace(), building );
+        const Funds expectedIncome = kingdom.GetIncome() * planningDays;
+
+        if ( kingdom.GetFunds() + expectedIncome < cost ) {
+            return {};
+        }
+
+        return cost - expectedIncome;
+    }
+
+    // Buildings from the list are bought in the order of their importance. Once a top priority building is found which cannot be bought today
+    // but will be affordable within a few days, the following buildings are bought only if they do not delay its construction.
+    bool Build( Castle & castle, const std::vector<BuildOrder> & buildOrderList, std::optional<Funds> & reservedFunds, int multiplier = 1 )
     {
         for ( std::vector<BuildOrder>::const_iterator it = buildOrderList.begin(); it != buildOrderList.end(); ++it ) {
+            if ( !isBuildingAffordableWithSavings( castle, it->building, reservedFunds ) ) {
+                continue;
+            }
+
             const int priority = it->priority * multiplier;
             if ( priority == 1 ) {
                 if ( BuildIfAvailable( castle, it->building ) )
                     return true;
+
+                if ( !reservedFunds ) {
+                    reservedFunds = getReservedFundsForBuilding( castle, it->building );
+                }
             }
             else {
                 if ( BuildIfEnoughResources( castle, it->building, GetResourceMultiplier( priority, priority + 1 ) ) )
@@ -152,7 +194,9 @@ namespace AI
             return BuildIfAvailable( castle, BUILD_WELL );
         }
 
-        if ( Build( castle, GetIncomeStructures( castle.GetRace() ) ) ) {
+        std::optional<Funds> reservedFunds;
+
+        if ( Build( castle, GetIncomeStructures( castle.GetRace() ), reservedFunds ) ) {
             return true;
         }
 
@@ -164,29 +208,32 @@ namespace AI
             return true;
         }
 
-        if ( Build( castle, GetBuildOrder( castle.GetRace() ) ) ) {
+        if ( Build( castle, GetBuildOrder( castle.GetRace() ), reservedFunds ) ) {
             return true;
         }
 
         if ( castle.GetLevelMageGuild() < spellLevel && safetyFactor > 0 ) {
             static const std::vector<BuildOrder> magicGuildUpgrades
                 = { { BUILD_MAGEGUILD2, 2 }, { BUILD_MAGEGUILD3, 2 }, { BUILD_MAGEGUILD4, 1 }, { BUILD_MAGEGUILD5, 1 } };
-            if ( Build( castle, magicGuildUpgrades ) ) {
+            if ( Build( castle, magicGuildUpgrades, reservedFunds ) ) {
                 return true;
             }
         }
 
         // Call internally checks if it's valid (space/resources) to buy one
-        if ( castle.GetKingdom().GetFunds() >= PaymentConditions::BuyBoat() * ( islandOrPeninsula ? 2 : 4 ) )
+        const Funds & funds = castle.GetKingdom().GetFunds();
+        if ( funds >= PaymentConditions::BuyBoat() * ( islandOrPeninsula ? 2 : 4 ) && ( !reservedFunds || funds - PaymentConditions::BuyBoat() >= *reservedFunds ) )
             castle.BuyBoat();
 
-        return Build( castle, GetDefensiveStructures(), 10 );
+        return Build( castle, GetDefensiveStructures(), reservedFunds, 10 );
     }
 
     void Normal::CastleTurn( Castle & castle, bool defensive )
     {
         if ( defensive ) {
-            Build( castle, GetDefensiveStructures() );
+            // The castle is under threat so there is no time to save resources.
+            std::optional<Funds> reservedFunds;
+            Build( castle, GetDefensiveStructures(), reservedFunds );
 
             castle.recruitBestAvailable( castle.GetKingdom().GetFunds() );
             OptimizeTroopsOrder( castle.GetArmy() );
@@ -140,10 +140,9 @@ namespace
         return heroArmyStrength > castle->GetGarrisonStrength( &hero ) * advantage;
     }
 
-    bool isHeroStrongerThan( const Maps::Tiles & tile, const MP2::MapObjectType objectType, AI::Normal & ai, const double heroArmyStrength,
-                             const double targetStrengthMultiplier )
+    bool isHeroStrongerThan( const Maps::Tiles & tile, const double heroArmyStrength, const double targetStrengthMultiplier )
     {
-        return heroArmyStrength > ai.getTargetArmyStrength( tile, objectType ) * targetStrengthMultiplier;
+        return heroArmyStrength > world.getTileArmyStrength( tile ) * targetStrengthMultiplier;
     }
 
     bool isArmyValuableToObtain( const Troop & monster, double armyStrengthThreshold, const bool armyHasMonster )
@@ -157,7 +156,7 @@ namespace
         return monster.GetStrength() > armyStrengthThreshold;
     }
 
-    bool HeroesValidObject( const Heroes & hero, const double heroArmyStrength, const int32_t index, const AIWorldPathfinder & pathfinder, AI::Normal & ai,
+    bool HeroesValidObject( const Heroes & hero, const double heroArmyStrength, const int32_t index, const AIWorldPathfinder & pathfinder,
                             const double armyStrengthThreshold )
     {
         const Maps::Tiles & tile = world.GetTiles( index );
@@ -217,7 +216,7 @@ namespace
         case MP2::OBJ_LIGHTHOUSE:
             if ( !hero.isFriends( tile.QuantityColor() ) ) {
                 if ( tile.isCaptureObjectProtected() ) {
-                    return isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, AI::ARMY_ADVANTAGE_SMALL );
+                    return isHeroStrongerThan( tile, heroArmyStrength, AI::ARMY_ADVANTAGE_SMALL );
                 }
 
                 return true;
@@ -227,7 +226,7 @@ namespace
         case MP2::OBJ_ABANDONEDMINE:
             if ( !hero.isFriends( tile.QuantityColor() ) ) {
                 if ( tile.isCaptureObjectProtected() ) {
-                    return isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, AI::ARMY_ADVANTAGE_LARGE );
+                    return isHeroStrongerThan( tile, heroArmyStrength, AI::ARMY_ADVANTAGE_LARGE );
                 }
 
                 return true;
@@ -258,7 +257,7 @@ namespace
 
             // 6 - 50 rogues, 7 - 1 gin, 8,9,10,11,12,13 - 1 monster level4
             if ( 5 < variants && 14 > variants ) {
-                return isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, AI::ARMY_ADVANTAGE_LARGE );
+                return isHeroStrongerThan( tile, heroArmyStrength, AI::ARMY_ADVANTAGE_LARGE );
             }
 
             // other
@@ -435,7 +434,7 @@ namespace
         case MP2::OBJ_CITYDEAD:
         case MP2::OBJ_TROLLBRIDGE: {
             if ( Color::NONE == tile.QuantityColor() ) {
-                return isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, AI::ARMY_ADVANTAGE_MEDIUM );
+                return isHeroStrongerThan( tile, heroArmyStrength, AI::ARMY_ADVANTAGE_MEDIUM );
             }
 
             const Troop & troop = tile.QuantityTroop();
@@ -486,7 +485,7 @@ namespace
         case MP2::OBJ_DERELICTSHIP:
             if ( !hero.isVisited( tile, Visit::GLOBAL ) && tile.QuantityIsValid() ) {
                 Army enemy( tile );
-                return enemy.isValid() && isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, 2 );
+                return enemy.isValid() && isHeroStrongerThan( tile, heroArmyStrength, 2 );
             }
             break;
 
@@ -494,17 +493,17 @@ namespace
             if ( !hero.isVisited( tile, Visit::GLOBAL ) && tile.QuantityIsValid() ) {
                 Army enemy( tile );
                 return enemy.isValid() && Skill::Level::EXPERT == hero.GetLevelSkill( Skill::Secondary::WISDOM )
-                       && isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, AI::ARMY_ADVANTAGE_LARGE );
+                       && isHeroStrongerThan( tile, heroArmyStrength, AI::ARMY_ADVANTAGE_LARGE );
             }
             break;
 
         case MP2::OBJ_DAEMONCAVE:
             if ( tile.QuantityIsValid() && 4 != tile.QuantityVariant() )
-                return isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, AI::ARMY_ADVANTAGE_MEDIUM );
+                return isHeroStrongerThan( tile, heroArmyStrength, AI::ARMY_ADVANTAGE_MEDIUM );
             break;
 
         case MP2::OBJ_MONSTER:
-            return isHeroStrongerThan( tile, objectType, ai, heroArmyStrength, ( hero.isLosingGame() ? 1.0 : AI::ARMY_ADVANTAGE_MEDIUM ) );
+            return isHeroStrongerThan( tile, heroArmyStrength, ( hero.isLosingGame() ? 1.0 : AI::ARMY_ADVANTAGE_MEDIUM ) );
 
         case MP2::OBJ_SIGN:
             // AI has no brains to process anything from sign messages.
@@ -603,10 +602,9 @@ namespace
     class ObjectValidator
     {
     public:
-        explicit ObjectValidator( const Heroes & hero, const AIWorldPathfinder & pathfinder, AI::Normal & ai )
+        explicit ObjectValidator( const Heroes & hero, const AIWorldPathfinder & pathfinder )
             : _hero( hero )
             , _pathfinder( pathfinder )
-            , _ai( ai )
             , _heroArmyStrength( hero.GetArmy().GetStrength() )
             , _armyStrengthThreshold( hero.getAIMininumJoiningArmyStrength() )
         {
@@ -620,7 +618,7 @@ namespace
                 return iter->second;
             }
 
-            const bool valid = HeroesValidObject( _hero, _heroArmyStrength, index, _pathfinder, _ai, _armyStrengthThreshold );
+            const bool valid = HeroesValidObject( _hero, _heroArmyStrength, index, _pathfinder, _armyStrengthThreshold );
             _validObjects[index] = valid;
             return valid;
         }
@@ -628,7 +626,6 @@ namespace
     private:
         const Heroes & _hero;
         const AIWorldPathfinder & _pathfinder;
-        AI::Normal & _ai;
 
         // Hero's strength value is valid till any action is done.
         // Since an instance of this class is used only for evaluation of the future movement it is appropriate to cache the strength.
@@ -1593,7 +1590,7 @@ namespace AI
 
         const uint32_t leftMovePoints = hero.GetMovePoints();
 
-        ObjectValidator objectValidator( hero, _pathfinder, *this );
+        ObjectValidator objectValidator( hero, _pathfinder );
         ObjectValueStorage valueStorage( hero, *this, lowestPossibleValue );
 
         auto getObjectValue = [&objectValidator, &valueStorage, this, heroStrength, &hero, leftMovePoints]( const int destination, uint32_t & distance, double & value,
@@ -1724,9 +1721,6 @@ namespace AI
             reinforceHeroInCastle( hero, *castle, castle->GetKingdom().GetFunds() );
         }
 
-        if ( isMonsterStrengthCacheable( objectType ) ) {
-            _neutralMonsterStrengthCache.erase( tileIndex );
-        }
         if ( objectType == MP2::OBJ_CASTLE || objectType == MP2::OBJ_HEROES ) {
             const auto it = _priorityTargets.find( tileIndex );
             if ( it != _priorityTargets.end() ) {
@@ -384,7 +384,7 @@ namespace AI
                 const double attackerThreat = attackerStrength - defenders;
                 if ( attackerThreat > 0 ) {
                     _priorityTargets[enemy.first] = PriorityTask::ATTACK;
-                    const uint32_t dist = _pathfinder.getDistance( enemy.first, castleIndex, myColor, attackerStrength );
+                    const uint32_t dist = _pathfinder.getDistance( enemy.first, castleIndex, myColor, attackerStrength, Skill::Level::EXPERT, threatDistanceLimit );
                     if ( dist && dist < threatDistanceLimit ) {
                         // castle is under threat
                         castlesInDanger.insert( castleIndex );
@@ -415,9 +415,6 @@ namespace AI
         KingdomHeroes & heroes = kingdom.GetHeroes();
         const KingdomCastles & castles = kingdom.GetCastles();
 
-        // Clear the cache of neutral monsters as their strength might have changed.
-        _neutralMonsterStrengthCache.clear();
-
         DEBUG_LOG( DBG_AI, DBG_INFO, Color::String( myColor ) << " starts the turn: " << castles.size() << " castles, " << heroes.size() << " heroes" )
         DEBUG_LOG( DBG_AI, DBG_INFO, "Funds: " << kingdom.GetFunds().String() )
 
@@ -521,7 +518,7 @@ namespace AI
                 }
             }
             else if ( objectType == MP2::OBJ_MONSTER ) {
-                stats.averageMonster += Army( tile ).GetStrength();
+                stats.averageMonster += world.getTileArmyStrength( tile );
                 ++stats.monsterCount;
             }
         }
@@ -1107,33 +1107,58 @@ int Army::GetMoraleModificator( std::string * strs ) const
 
 double Army::GetStrength() const
 {
-    double result = 0;
-    const uint32_t archery = ( commander != nullptr ) ? commander->GetSecondaryValues( Skill::Secondary::ARCHERY ) : 0;
-    // Hero bonus calculation is slow, cache it
-    const int bonusAttack = ( commander ? commander->GetAttack() : 0 );
-    const int bonusDefense = ( commander ? commander->GetDefense() : 0 );
-    const int armyMorale = GetMorale();
-    const int armyLuck = GetLuck();
+    assert( size() <= maximumTroopCount );
 
-    for ( const_iterator it = begin(); it != end(); ++it ) {
-        const Troop * troop = *it;
-        if ( troop != nullptr && troop->isValid() ) {
-            double strength = troop->GetStrengthWithBonus( bonusAttack, bonusDefense );
+    StrengthCacheKey key;
+    for ( size_t i = 0; i < size(); ++i ) {
+        const Troop * troop = at( i );
+        if ( troop != nullptr ) {
+            key.troops[i] = { troop->GetID(), troop->GetCount() };
+        }
+    }
 
-            if ( archery > 0 && troop->isArchers() ) {
-                strength *= sqrt( 1 + static_cast<double>( archery ) / 100 );
-            }
+    // Hero bonuses depend on artifacts, skills, visited objects and castle buildings, so they are always re-evaluated.
+    // Without a commander the morale and luck of the army depend only on its troops.
+    if ( commander != nullptr ) {
+        key.commander = commander;
+        key.archery = commander->GetSecondaryValues( Skill::Secondary::ARCHERY );
+        key.bonusAttack = commander->GetAttack();
+        key.bonusDefense = commander->GetDefense();
+        key.morale = GetMorale();
+        key.luck = GetLuck();
+    }
+
+    if ( !_isStrengthCacheValid || !( key == _strengthCacheKey ) ) {
+        const int armyMorale = ( commander != nullptr ) ? key.morale : GetMorale();
+        const int armyLuck = ( commander != nullptr ) ? key.luck : GetLuck();
 
-            // GetMorale checks if unit is affected by it
-            if ( troop->isAffectedByMorale() )
-                strength *= 1 + ( ( armyMorale < 0 ) ? armyMorale / 12.0 : armyMorale / 24.0 );
+        double troopsStrength = 0;
 
-            strength *= 1 + armyLuck / 24.0;
+        for ( const Troop * troop : *this ) {
+            if ( troop != nullptr && troop->isValid() ) {
+                double strength = troop->GetStrengthWithBonus( key.bonusAttack, key.bonusDefense );
+
+                if ( key.archery > 0 && troop->isArchers() ) {
+                    strength *= sqrt( 1 + static_cast<double>( key.archery ) / 100 );
+                }
 
-            result += strength;
+                // GetMorale checks if unit is affected by it
+                if ( troop->isAffectedByMorale() )
+                    strength *= 1 + ( ( armyMorale < 0 ) ? armyMorale / 12.0 : armyMorale / 24.0 );
+
+                strength *= 1 + armyLuck / 24.0;
+
+                troopsStrength += strength;
+            }
         }
+
+        _strengthCacheKey = key;
+        _cachedTroopsStrength = troopsStrength;
+        _isStrengthCacheValid = true;
     }
 
+    double result = _cachedTroopsStrength;
+
     if ( commander ) {
         result += commander->GetMagicStrategicValue( result );
     }
@@ -1141,6 +1166,12 @@ double Army::GetStrength() const
     return result;
 }
 
+bool Army::StrengthCacheKey::operator==( const StrengthCacheKey & other ) const
+{
+    return troops == other.troops && commander == other.commander && archery == other.archery && bonusAttack == other.bonusAttack
+           && bonusDefense == other.bonusDefense && morale == other.morale && luck == other.luck;
+}
+
 void Army::Reset( const bool soft /* = false */ )
 {
     Troops::Clean();
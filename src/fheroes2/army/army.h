@@ -24,10 +24,12 @@
 #ifndef H2ARMY_H
 #define H2ARMY_H
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "monster.h"
@@ -245,6 +247,24 @@ protected:
     int color;
 
 private:
+    // Everything that affects the strength of troops calculated in GetStrength() apart from the commander's spells
+    struct StrengthCacheKey
+    {
+        std::array<std::pair<int, uint32_t>, maximumTroopCount> troops{};
+        const HeroBase * commander{ nullptr };
+        uint32_t archery{ 0 };
+        int bonusAttack{ 0 };
+        int bonusDefense{ 0 };
+        int morale{ 0 };
+        int luck{ 0 };
+
+        bool operator==( const StrengthCacheKey & other ) const;
+    };
+
+    mutable StrengthCacheKey _strengthCacheKey;
+    mutable double _cachedTroopsStrength{ 0 };
+    mutable bool _isStrengthCacheValid{ false };
+
     // Performs the pre-battle arrangement of given monsters in a given number, dividing them into a given number of stacks if possible
     void ArrangeForBattle( const Monster & monster, const uint32_t monstersCount, const uint32_t stacksCount );
     // Performs the pre-battle arrangement of given monsters in a given number, dividing them into a random number of stacks (seeded by
@@ -32,7 +32,7 @@
 #include <ostream>
 #include <utility>
 
-#include "agg_file.h"
+#include "agg.h"
 #include "audio_manager.h"
 #include "dir.h"
 #include "logging.h"
@@ -149,12 +149,10 @@ namespace
         int channelId{ -1 };
     };
 
-    std::vector<uint8_t> getDataFromAggFile( const std::string & key, const bool ignoreExpansion );
-
     void LoadWAV( int m82, std::vector<uint8_t> & v )
     {
         DEBUG_LOG( DBG_ENGINE, DBG_TRACE, M82::GetString( m82 ) )
-        const std::vector<uint8_t> & body = getDataFromAggFile( M82::GetString( m82 ), false );
+        const fheroes2::FileData body = AGG::getDataViewFromAggFile( M82::GetString( m82 ) );
 
         if ( !body.empty() ) {
             // create WAV format
@@ -175,41 +173,123 @@ namespace
 
             v.reserve( body.size() + 44 );
             v.assign( wavHeader.data(), wavHeader.data() + 44 );
-            v.insert( v.begin() + 44, body.begin(), body.end() );
+            v.insert( v.end(), body.data(), body.data() + body.size() );
         }
     }
 
     void LoadMID( int xmi, std::vector<uint8_t> & v )
     {
         DEBUG_LOG( DBG_ENGINE, DBG_TRACE, XMI::GetString( xmi ) )
-        const std::vector<uint8_t> & body = getDataFromAggFile( XMI::GetString( xmi ), xmi >= XMI::MIDI_ORIGINAL_KNIGHT );
+        const fheroes2::FileData body = AGG::getDataViewFromAggFile( XMI::GetString( xmi ), xmi >= XMI::MIDI_ORIGINAL_KNIGHT );
 
         if ( !body.empty() ) {
-            v = Music::Xmi2Mid( body );
+            v = Music::Xmi2Mid( body.data(), body.size() );
         }
     }
 
-    std::map<int, std::vector<uint8_t>> wavDataCache;
-    std::map<int, std::vector<uint8_t>> MIDDataCache;
+    // Maximum amount of memory occupied by each of the sound and music data caches.
+    const size_t maxAudioDataCacheSize = 16 * 1024 * 1024;
 
-    const std::vector<uint8_t> & GetWAV( int m82 )
+    // Sound and music data caches have their own lock so audio data can be loaded from any thread without holding the AudioManager's resource mutex.
+    // Data is shared with callers, so the least recently used entries can be evicted at any time without invalidating data which is still in use.
+    class AudioDataCache
     {
-        std::vector<uint8_t> & v = wavDataCache[m82];
-        if ( v.empty() ) {
-            LoadWAV( m82, v );
+    public:
+        explicit AudioDataCache( void ( *loadData )( int, std::vector<uint8_t> & ) )
+            : _loadData( loadData )
+        {
+            // Do nothing.
         }
 
-        return v;
-    }
+        AudioDataCache( const AudioDataCache & ) = delete;
 
-    const std::vector<uint8_t> & GetMID( int xmi )
-    {
-        std::vector<uint8_t> & v = MIDDataCache[xmi];
-        if ( v.empty() ) {
-            LoadMID( xmi, v );
+        AudioDataCache & operator=( const AudioDataCache & ) = delete;
+
+        std::shared_ptr<const std::vector<uint8_t>> get( const int id )
+        {
+            {
+                std::scoped_lock<std::mutex> lock( _mutex );
+
+                const auto iter = _data.find( id );
+                if ( iter != _data.end() ) {
+                    iter->second.lastUseTime = ++_useCounter;
+                    return iter->second.data;
+                }
+            }
+
+            // Load data without holding the lock. If another thread loads the same data at the same time only one copy is kept.
+            auto data = std::make_shared<std::vector<uint8_t>>();
+            _loadData( id, *data );
+
+            if ( data->empty() ) {
+                return data;
+            }
+
+            std::scoped_lock<std::mutex> lock( _mutex );
+
+            const auto [iter, inserted] = _data.try_emplace( id );
+            if ( inserted ) {
+                iter->second.data = std::move( data );
+                _totalSize += iter->second.data->size();
+            }
+
+            iter->second.lastUseTime = ++_useCounter;
+
+            std::shared_ptr<const std::vector<uint8_t>> result = iter->second.data;
+
+            shrink();
+
+            return result;
+        }
+
+        void clear()
+        {
+            std::scoped_lock<std::mutex> lock( _mutex );
+
+            _data.clear();
+            _totalSize = 0;
         }
 
-        return v;
+    private:
+        struct DataInfo
+        {
+            std::shared_ptr<const std::vector<uint8_t>> data;
+            uint64_t lastUseTime{ 0 };
+        };
+
+        void ( *_loadData )( int, std::vector<uint8_t> & );
+
+        std::mutex _mutex;
+        std::map<int, DataInfo> _data;
+
+        size_t _totalSize{ 0 };
+        uint64_t _useCounter{ 0 };
+
+        // Remove the least recently used entries until the cache fits into the memory limit. Must be called under the lock.
+        void shrink()
+        {
+            while ( _totalSize > maxAudioDataCacheSize && !_data.empty() ) {
+                const auto oldestIter = std::min_element( _data.begin(), _data.end(), []( const auto & first, const auto & second ) {
+                    return first.second.lastUseTime < second.second.lastUseTime;
+                } );
+
+                _totalSize -= oldestIter->second.data->size();
+                _data.erase( oldestIter );
+            }
+        }
+    };
+
+    AudioDataCache wavDataCache( LoadWAV );
+    AudioDataCache MIDDataCache( LoadMID );
+
+    std::shared_ptr<const std::vector<uint8_t>> GetWAV( int m82 )
+    {
+        return wavDataCache.get( m82 );
+    }
+
+    std::shared_ptr<const std::vector<uint8_t>> GetMID( int xmi )
+    {
+        return MIDDataCache.get( xmi );
     }
 
     void PlaySoundImp( const int m82, const int soundVolume );
@@ -283,7 +363,7 @@ namespace
             _taskToExecute = TaskType::None;
         }
 
-        // This mutex protects operations with AudioManager's resources, such as AGG files, data caches, etc
+        // This mutex protects AudioManager's playback state, such as the current music track, loop sound effects, etc
         std::recursive_mutex & resourceMutex()
         {
             return _resourceMutex;
@@ -431,22 +511,6 @@ namespace
     // The music track that is currently being played
     std::atomic<int> currentMusicTrackId{ MUS::UNKNOWN };
 
-    fheroes2::AGGFile g_midiHeroes2AGG;
-    fheroes2::AGGFile g_midiHeroes2xAGG;
-
-    std::vector<uint8_t> getDataFromAggFile( const std::string & key, const bool ignoreExpansion )
-    {
-        if ( !ignoreExpansion && g_midiHeroes2xAGG.isGood() ) {
-            // Make sure that the below container is not const and not a reference
-            // so returning it from the function will invoke a move constructor instead of copy constructor.
-            std::vector<uint8_t> buf = g_midiHeroes2xAGG.read( key );
-            if ( !buf.empty() )
-                return buf;
-        }
-
-        return g_midiHeroes2AGG.read( key );
-    }
-
     AsyncSoundManager g_asyncSoundManager;
 
     void PlaySoundImp( const int m82, const int soundVolume )
@@ -455,12 +519,13 @@ namespace
 
         DEBUG_LOG( DBG_ENGINE, DBG_TRACE, "Try to play sound " << M82::GetString( m82 ) )
 
-        const std::vector<uint8_t> & v = GetWAV( m82 );
+        const std::shared_ptr<const std::vector<uint8_t>> data = GetWAV( m82 );
+        const std::vector<uint8_t> & v = *data;
         if ( v.empty() ) {
             return;
         }
 
-        const int channelId = Mixer::Play( &v[0], static_cast<uint32_t>( v.size() ), -1, false );
+        const int channelId = Mixer::Play( m82, &v[0], static_cast<uint32_t>( v.size() ), -1, false );
         if ( channelId < 0 ) {
             // Failed to get a free channel.
             return;
@@ -540,7 +605,7 @@ namespace
 
         // Check if music needs to be pulled from HEROES2X
         if ( musicType == MUSIC_MIDI_EXPANSION ) {
-            xmi = XMI::FromMUS( trackId, g_midiHeroes2xAGG.isGood() );
+            xmi = XMI::FromMUS( trackId, Settings::Get().isPriceOfLoyaltySupported() );
         }
 
         if ( XMI::UNKNOWN == xmi ) {
@@ -548,7 +613,8 @@ namespace
         }
 
         if ( XMI::UNKNOWN != xmi ) {
-            const std::vector<uint8_t> & v = GetMID( xmi );
+            const std::shared_ptr<const std::vector<uint8_t>> data = GetMID( xmi );
+            const std::vector<uint8_t> & v = *data;
             if ( !v.empty() ) {
                 Music::Play( musicUID, v, playbackMode );
 
@@ -734,7 +800,8 @@ namespace
 
             for ( const AudioManager::AudioLoopEffectInfo & info : effects ) {
                 // It is a new sound effect. Register and play it.
-                const std::vector<uint8_t> & audioData = GetWAV( soundType );
+                const std::shared_ptr<const std::vector<uint8_t>> data = GetWAV( soundType );
+                const std::vector<uint8_t> & audioData = *data;
                 if ( audioData.empty() ) {
                     // Looks like nothing to play. Ignore it.
                     continue;
@@ -742,10 +809,11 @@ namespace
 
                 int channelId = -1;
                 if ( is3DAudioEnabled ) {
-                    channelId = Mixer::PlayFromDistance( &audioData[0], static_cast<uint32_t>( audioData.size() ), -1, true, info.angle, info.volumePercentage );
+                    channelId
+                        = Mixer::PlayFromDistance( soundType, &audioData[0], static_cast<uint32_t>( audioData.size() ), -1, true, info.angle, info.volumePercentage );
                 }
                 else {
-                    channelId = Mixer::Play( &audioData[0], static_cast<uint32_t>( audioData.size() ), -1, true );
+                    channelId = Mixer::Play( soundType, &audioData[0], static_cast<uint32_t>( audioData.size() ), -1, true );
                 }
 
                 if ( channelId < 0 ) {
@@ -774,7 +842,7 @@ namespace
 
 namespace AudioManager
 {
-    AudioInitializer::AudioInitializer( const std::string & originalAGGFilePath, const std::string & expansionAGGFilePath, const ListFiles & midiSoundFonts )
+    AudioInitializer::AudioInitializer( const ListFiles & midiSoundFonts )
     {
         if ( Audio::isValid() ) {
             Mixer::SetChannels( 32 );
@@ -789,15 +857,6 @@ namespace AudioManager
             Music::setVolume( 100 * Settings::Get().MusicVolume() / 10 );
             Music::SetFadeInMs( 900 );
         }
-
-        assert( !originalAGGFilePath.empty() );
-        if ( !g_midiHeroes2AGG.open( originalAGGFilePath ) ) {
-            VERBOSE_LOG( "Failed to open HEROES2.AGG file for audio playback." )
-        }
-
-        if ( !expansionAGGFilePath.empty() && !g_midiHeroes2xAGG.open( expansionAGGFilePath ) ) {
-            VERBOSE_LOG( "Failed to open HEROES2X.AGG file for audio playback." )
-        }
     }
 
     AudioInitializer::~AudioInitializer()
@@ -807,6 +866,7 @@ namespace AudioManager
 
         wavDataCache.clear();
         MIDDataCache.clear();
+
         currentAudioLoopEffects.clear();
     }
 
@@ -123,7 +123,7 @@ void Battle::Board::SetPositionQuality( const Unit & b ) const
             continue;
         }
 
-        const Indexes around = GetAroundIndexes( *unit );
+        const AroundIndexes around = GetAroundIndexes( *unit );
         for ( const int32_t index : around ) {
             Cell * cell2 = GetCell( index );
             if ( !cell2 || !cell2->isPassableForUnit( b ) )
@@ -544,7 +544,7 @@ int32_t Battle::Board::OptimalAttackValue( const Unit & attacker, const Unit & t
             return 0;
         }
 
-        Indexes aroundAttacker = GetAroundIndexes( position );
+        const AroundIndexes aroundAttacker = GetAroundIndexes( position );
 
         std::set<const Unit *> unitsUnderAttack;
         Board * board = Arena::GetBoard();
@@ -1003,13 +1003,11 @@ Battle::Cell * Battle::Board::GetCell( int32_t position, int dir )
     return nullptr;
 }
 
-Battle::Indexes Battle::Board::GetMoveWideIndexes( int32_t center, bool reflect )
+Battle::AroundIndexes Battle::Board::GetMoveWideIndexes( int32_t center, bool reflect )
 {
-    Indexes result;
+    AroundIndexes result;
 
     if ( isValidIndex( center ) ) {
-        result.reserve( 4 );
-
         if ( reflect ) {
             if ( isValidDirection( center, LEFT ) )
                 result.push_back( GetIndexDirection( center, LEFT ) );
@@ -1034,13 +1032,11 @@ Battle::Indexes Battle::Board::GetMoveWideIndexes( int32_t center, bool reflect
     return result;
 }
 
-Battle::Indexes Battle::Board::GetAroundIndexes( int32_t center, int32_t ignore )
+Battle::AroundIndexes Battle::Board::GetAroundIndexes( int32_t center, int32_t ignore )
 {
-    Indexes result;
+    AroundIndexes result;
 
     if ( isValidIndex( center ) ) {
-        result.reserve( 12 );
-
         for ( direction_t dir = TOP_LEFT; dir < CENTER; ++dir )
             if ( isValidDirection( center, dir ) && GetIndexDirection( center, dir ) != ignore )
                 result.push_back( GetIndexDirection( center, dir ) );
@@ -1049,21 +1045,22 @@ Battle::Indexes Battle::Board::GetAroundIndexes( int32_t center, int32_t ignore
     return result;
 }
 
-Battle::Indexes Battle::Board::GetAroundIndexes( const Unit & b )
+Battle::AroundIndexes Battle::Board::GetAroundIndexes( const Unit & b )
 {
     return GetAroundIndexes( b.GetPosition() );
 }
 
-Battle::Indexes Battle::Board::GetAroundIndexes( const Position & position )
+Battle::AroundIndexes Battle::Board::GetAroundIndexes( const Position & position )
 {
     const int headIdx = position.GetHead()->GetIndex();
 
     if ( position.GetTail() ) {
         const int tailIdx = position.GetTail()->GetIndex();
 
-        Indexes around = GetAroundIndexes( headIdx, tailIdx );
-        const Indexes & tail = GetAroundIndexes( tailIdx, headIdx );
-        around.insert( around.end(), tail.begin(), tail.end() );
+        AroundIndexes around = GetAroundIndexes( headIdx, tailIdx );
+        for ( const int32_t index : GetAroundIndexes( tailIdx, headIdx ) ) {
+            around.push_back( index );
+        }
 
         std::sort( around.begin(), around.end() );
         around.erase( std::unique( around.begin(), around.end() ), around.end() );
@@ -1089,7 +1086,7 @@ Battle::Indexes Battle::Board::GetDistanceIndexes( int32_t center, uint32_t radi
             std::set<int32_t> tm = st;
 
             for ( Indexes::const_iterator it = abroad.begin(); it != abroad.end(); ++it ) {
-                const Indexes around = GetAroundIndexes( *it );
+                const AroundIndexes around = GetAroundIndexes( *it );
                 tm.insert( around.begin(), around.end() );
             }
 
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "battle_cell.h"
+#include "fixed_vector.h"
 #include "math_base.h"
 
 #define ARENAW 11
@@ -56,6 +57,9 @@ namespace Battle
     }
 
     using Indexes = std::vector<int32_t>;
+    // A cell has at most 6 neighbours and a wide unit occupying 2 cells is surrounded by at most 8 cells, but the lists of neighbours
+    // of the head and the tail are merged in place, so the capacity has to fit both of them before duplicates are removed.
+    using AroundIndexes = fheroes2::FixedVector<int32_t, 10>;
 
     class Board : public std::vector<Cell>
     {
@@ -101,10 +105,10 @@ namespace Battle
         static bool isValidDirection( int32_t, int );
         static int32_t GetIndexDirection( int32_t, int );
         static Indexes GetDistanceIndexes( int32_t, uint32_t );
-        static Indexes GetAroundIndexes( int32_t center, int32_t ignore = -1 );
-        static Indexes GetAroundIndexes( const Unit & unit );
-        static Indexes GetAroundIndexes( const Position & position );
-        static Indexes GetMoveWideIndexes( int32_t, bool reflect );
+        static AroundIndexes GetAroundIndexes( int32_t center, int32_t ignore = -1 );
+        static AroundIndexes GetAroundIndexes( const Unit & unit );
+        static AroundIndexes GetAroundIndexes( const Position & position );
+        static AroundIndexes GetMoveWideIndexes( int32_t, bool reflect );
         static bool isValidMirrorImageIndex( const int32_t index, const Unit * unit );
 
         // Checks that the current unit (to which the current passability information relates) is able (in principle)
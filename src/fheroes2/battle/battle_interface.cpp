@@ -1019,6 +1019,7 @@ Battle::Interface::Interface( Arena & battleArena, const int32_t tileIndex )
     , animation_flags_frame( 0 )
     , catapult_frame( 0 )
     , _interruptAutoBattleForColor( 0 )
+    , _isBattleGroundWithGrid( false )
     , _contourColor( 110 )
     , _brightLandType( false )
     , _contourCycle( 0 )
@@ -1274,6 +1275,20 @@ void Battle::Interface::RedrawArmies()
         RedrawKilled();
     }
 
+    // Units of every row are sorted into these lists. The lists are shared by all rows to avoid memory allocations on every frame.
+    // Without a castle only the "before wall" lists are used.
+    std::vector<const Unit *> deadTroopBeforeWall;
+    std::vector<const Unit *> deadTroopAfterWall;
+
+    std::vector<const Unit *> troopCounterBeforeWall;
+    std::vector<const Unit *> troopCounterAfterWall;
+
+    std::vector<const Unit *> troopBeforeWall;
+    std::vector<const Unit *> troopAfterWall;
+
+    std::vector<const Unit *> movingTroopBeforeWall;
+    std::vector<const Unit *> movingTroopAfterWall;
+
     for ( int32_t cellRowId = 0; cellRowId < ARENAH; ++cellRowId ) {
         // Redraw objects.
         for ( int32_t cellColumnId = 0; cellColumnId < ARENAW; ++cellColumnId ) {
@@ -1290,17 +1305,17 @@ void Battle::Interface::RedrawArmies()
                 RedrawCastle( *castle, Arena::CATAPULT_POS );
             }
 
-            std::vector<const Unit *> deadTroopBeforeWall;
-            std::vector<const Unit *> deadTroopAfterWall;
+            deadTroopBeforeWall.clear();
+            deadTroopAfterWall.clear();
 
-            std::vector<const Unit *> troopCounterBeforeWall;
-            std::vector<const Unit *> troopCounterAfterWall;
+            troopCounterBeforeWall.clear();
+            troopCounterAfterWall.clear();
 
-            std::vector<const Unit *> troopBeforeWall;
-            std::vector<const Unit *> troopAfterWall;
+            troopBeforeWall.clear();
+            troopAfterWall.clear();
 
-            std::vector<const Unit *> movingTroopBeforeWall;
-            std::vector<const Unit *> movingTroopAfterWall;
+            movingTroopBeforeWall.clear();
+            movingTroopAfterWall.clear();
 
             const int32_t wallCellId = wallCellIds[cellRowId];
 
@@ -1398,9 +1413,9 @@ void Battle::Interface::RedrawArmies()
             }
         }
         else {
-            std::vector<const Unit *> troopCounter;
-            std::vector<const Unit *> troop;
-            std::vector<const Unit *> movingTroop;
+            troopCounterBeforeWall.clear();
+            troopBeforeWall.clear();
+            movingTroopBeforeWall.clear();
 
             // Redraw monsters.
             for ( int32_t cellColumnId = 0; cellColumnId < ARENAW; ++cellColumnId ) {
@@ -1415,27 +1430,27 @@ void Battle::Interface::RedrawArmies()
                     const int unitAnimState = unitOnCell->GetAnimationState();
                     const bool isStaticUnit = unitAnimState == Monster_Info::STATIC || unitAnimState == Monster_Info::IDLE;
                     if ( isStaticUnit ) {
-                        troopCounter.emplace_back( unitOnCell );
+                        troopCounterBeforeWall.emplace_back( unitOnCell );
                     }
 
-                    troop.emplace_back( unitOnCell );
+                    troopBeforeWall.emplace_back( unitOnCell );
                 }
                 else {
-                    movingTroop.emplace_back( unitOnCell );
+                    movingTroopBeforeWall.emplace_back( unitOnCell );
                 }
             }
 
             // Redraw monster counters.
-            for ( size_t i = 0; i < troop.size(); ++i ) {
-                RedrawTroopSprite( *troop[i] );
+            for ( size_t i = 0; i < troopBeforeWall.size(); ++i ) {
+                RedrawTroopSprite( *troopBeforeWall[i] );
             }
 
-            for ( size_t i = 0; i < troopCounter.size(); ++i ) {
-                RedrawTroopCount( *troopCounter[i] );
+            for ( size_t i = 0; i < troopCounterBeforeWall.size(); ++i ) {
+                RedrawTroopCount( *troopCounterBeforeWall[i] );
             }
 
-            for ( size_t i = 0; i < movingTroop.size(); ++i ) {
-                RedrawTroopSprite( *movingTroop[i] );
+            for ( size_t i = 0; i < movingTroopBeforeWall.size(); ++i ) {
+                RedrawTroopSprite( *movingTroopBeforeWall[i] );
             }
         }
 
@@ -1568,13 +1583,13 @@ void Battle::Interface::RedrawTroopSprite( const Unit & unit )
         drawTroopSprite( unit, monsterSprite );
     }
     else if ( unit.Modes( CAP_MIRRORIMAGE ) ) {
+        const int monsterIcnId = unit.GetMonsterSprite();
         fheroes2::Sprite monsterSprite;
 
         if ( _currentUnit == &unit && b_current_sprite != nullptr ) {
             monsterSprite = *b_current_sprite;
         }
         else {
-            const int monsterIcnId = unit.GetMonsterSprite();
             monsterSprite = fheroes2::AGG::GetICN( monsterIcnId, unit.GetFrame() );
         }
 
@@ -1584,8 +1599,8 @@ void Battle::Interface::RedrawTroopSprite( const Unit & unit )
 
         if ( _currentUnit == &unit && b_current_sprite == nullptr ) {
             // Current unit's turn which is idling.
-            const fheroes2::Sprite & monsterContour = fheroes2::CreateContour( monsterSprite, _contourColor );
-            fheroes2::Blit( monsterContour, _mainSurface, drawnPosition.x, drawnPosition.y, unit.isReflect() );
+            const std::vector<fheroes2::Point> & monsterContour = getMonsterContour( monsterIcnId, unit.GetFrame() );
+            fheroes2::DrawContour( _mainSurface, monsterContour, monsterSprite.width(), drawnPosition.x, drawnPosition.y, _contourColor, unit.isReflect() );
         }
     }
     else {
@@ -1598,12 +1613,25 @@ void Battle::Interface::RedrawTroopSprite( const Unit & unit )
 
         if ( _currentUnit == &unit && b_current_sprite == nullptr ) {
             // Current unit's turn which is idling.
-            const fheroes2::Sprite & monsterContour = fheroes2::CreateContour( monsterSprite, _contourColor );
-            fheroes2::Blit( monsterContour, _mainSurface, drawnPosition.x, drawnPosition.y, unit.isReflect() );
+            const std::vector<fheroes2::Point> & monsterContour = getMonsterContour( monsterIcnId, unit.GetFrame() );
+            fheroes2::DrawContour( _mainSurface, monsterContour, monsterSprite.width(), drawnPosition.x, drawnPosition.y, _contourColor, unit.isReflect() );
         }
     }
 }
 
+const std::vector<fheroes2::Point> & Battle::Interface::getMonsterContour( const int monsterIcnId, const int frame )
+{
+    const std::pair<int, int> key( monsterIcnId, frame );
+
+    auto iter = _monsterContours.find( key );
+    if ( iter == _monsterContours.end() ) {
+        // Palette changes do not affect the transform layer so the contour depends only on the original sprite.
+        iter = _monsterContours.emplace( key, fheroes2::GetContourPoints( fheroes2::AGG::GetICN( monsterIcnId, frame ) ) ).first;
+    }
+
+    return iter->second;
+}
+
 fheroes2::Point Battle::Interface::drawTroopSprite( const Unit & unit, const fheroes2::Sprite & troopSprite )
 {
     const fheroes2::Rect & rt = unit.GetRectPosition();
@@ -1701,7 +1729,7 @@ void Battle::Interface::RedrawCover()
         if ( humanturn_spell.isValid() ) {
             switch ( humanturn_spell.GetID() ) {
             case Spell::COLDRING: {
-                const Indexes around = Board::GetAroundIndexes( index_pos );
+                const AroundIndexes around = Board::GetAroundIndexes( index_pos );
                 for ( size_t i = 0; i < around.size(); ++i ) {
                     const Cell * nearbyCell = Board::GetCell( around[i] );
                     if ( nearbyCell != nullptr ) {
@@ -1713,7 +1741,7 @@ void Battle::Interface::RedrawCover()
             case Spell::FIREBALL:
             case Spell::METEORSHOWER: {
                 highlightCells.emplace( cell );
-                const Indexes around = Board::GetAroundIndexes( index_pos );
+                const AroundIndexes around = Board::GetAroundIndexes( index_pos );
                 for ( size_t i = 0; i < around.size(); ++i ) {
                     const Cell * nearbyCell = Board::GetCell( around[i] );
                     if ( nearbyCell != nullptr ) {
@@ -1740,7 +1768,7 @@ void Battle::Interface::RedrawCover()
         else if ( _currentUnit->isAbilityPresent( fheroes2::MonsterAbilityType::AREA_SHOT )
                   && ( cursorType == Cursor::WAR_ARROW || cursorType == Cursor::WAR_BROKENARROW ) ) {
             highlightCells.emplace( cell );
-            const Indexes around = Board::GetAroundIndexes( index_pos );
+            const AroundIndexes around = Board::GetAroundIndexes( index_pos );
             for ( size_t i = 0; i < around.size(); ++i ) {
                 const Cell * nearbyCell = Board::GetCell( around[i] );
                 if ( nearbyCell != nullptr ) {
@@ -1849,6 +1877,30 @@ void Battle::Interface::RedrawCover()
 }
 
 void Battle::Interface::RedrawCoverStatic( const Settings & conf, const Board & board )
+{
+    const bool showGrid = conf.BattleShowGrid();
+
+    // The battlefield itself does not change during the battle, only the grid can be turned on or off.
+    if ( !_battleGround.empty() && _isBattleGroundWithGrid == showGrid ) {
+        fheroes2::Copy( _battleGround, _mainSurface );
+    }
+    else {
+        RedrawBattleGround( showGrid, board );
+
+        fheroes2::Copy( _mainSurface, _battleGround );
+        _isBattleGroundWithGrid = showGrid;
+    }
+
+    if ( !_movingUnit && conf.BattleShowMoveShadow() && _currentUnit && !( _currentUnit->GetCurrentControl() & CONTROL_AI ) ) { // shadow
+        for ( const Cell & cell : board ) {
+            if ( cell.isReachableForHead() || cell.isReachableForTail() ) {
+                fheroes2::Blit( sf_shadow, _mainSurface, cell.GetPos().x, cell.GetPos().y );
+            }
+        }
+    }
+}
+
+void Battle::Interface::RedrawBattleGround( const bool showGrid, const Board & board )
 {
     if ( icn_cbkg != ICN::UNKNOWN ) {
         const fheroes2::Sprite & cbkg = fheroes2::AGG::GetICN( icn_cbkg, 0 );
@@ -1904,7 +1956,7 @@ void Battle::Interface::RedrawCoverStatic( const Settings & conf, const Board &
         }
     }
 
-    if ( conf.BattleShowGrid() ) { // grid
+    if ( showGrid ) { // grid
         for ( const Cell & cell : board ) {
             fheroes2::Blit( sf_hexagon, _mainSurface, cell.GetPos().x, cell.GetPos().y );
         }
@@ -1920,14 +1972,6 @@ void Battle::Interface::RedrawCoverStatic( const Settings & conf, const Board &
         const fheroes2::Sprite & sprite2 = fheroes2::AGG::GetICN( castleBackgroundIcnId, castle->isFortificationBuild() ? 4 : 3 );
         fheroes2::Blit( sprite2, _mainSurface, sprite2.x(), sprite2.y() );
     }
-
-    if ( !_movingUnit && conf.BattleShowMoveShadow() && _currentUnit && !( _currentUnit->GetCurrentControl() & CONTROL_AI ) ) { // shadow
-        for ( const Cell & cell : board ) {
-            if ( cell.isReachableForHead() || cell.isReachableForTail() ) {
-                fheroes2::Blit( sf_shadow, _mainSurface, cell.GetPos().x, cell.GetPos().y );
-            }
-        }
-    }
 }
 
 void Battle::Interface::RedrawCastle( const Castle & castle, int32_t cellId )
@@ -25,6 +25,7 @@
 #define H2BATTLE_INTERFACE_H
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -307,6 +308,7 @@ namespace Battle
 
         void RedrawCover();
         void RedrawCoverStatic( const Settings & conf, const Board & board );
+        void RedrawBattleGround( const bool showGrid, const Board & board );
         void RedrawLowObjects( int32_t );
         void RedrawHighObjects( int32_t );
         void RedrawCastle( const Castle &, int32_t );
@@ -320,6 +322,9 @@ namespace Battle
 
         fheroes2::Point drawTroopSprite( const Unit & unit, const fheroes2::Sprite & troopSprite );
 
+        // Returns the contour of the given monster sprite. Contours are cached as they are drawn every frame for the current unit.
+        const std::vector<fheroes2::Point> & getMonsterContour( const int monsterIcnId, const int frame );
+
         void RedrawTroopCount( const Unit & unit );
 
         void RedrawActionWincesKills( const TargetsInfo & targets, Unit * attacker = nullptr );
@@ -372,6 +377,7 @@ namespace Battle
         fheroes2::Rect _interfacePosition;
         fheroes2::Rect _surfaceInnerArea;
         fheroes2::Image _mainSurface;
+        fheroes2::Image _battleGround; // cached static part of the battlefield drawn by RedrawBattleGround()
         fheroes2::Image sf_hexagon;
         fheroes2::Image sf_shadow;
         fheroes2::Image sf_cursor;
@@ -395,11 +401,14 @@ namespace Battle
         int catapult_frame;
 
         int _interruptAutoBattleForColor;
+        bool _isBattleGroundWithGrid;
 
         uint8_t _contourColor;
         bool _brightLandType; // used to determine current monster contour cycling colors
         uint32_t _contourCycle;
 
+        std::map<std::pair<int, int>, std::vector<fheroes2::Point>> _monsterContours;
+
         const Unit * _currentUnit;
         const Unit * _movingUnit;
         const Unit * _flyingUnit;
@@ -191,7 +191,7 @@ namespace Battle
                     const int32_t unitIdx = it->GetIndex();
                     BattleNode & unitNode = _cache[unitIdx];
 
-                    const Indexes & around = Battle::Board::GetAroundIndexes( unitIdx );
+                    const AroundIndexes around = Battle::Board::GetAroundIndexes( unitIdx );
                     for ( const int32_t cell : around ) {
                         const uint32_t flyingDist = Battle::Board::GetDistance( pathStart, cell );
                         if ( hexIsPassable( cell ) && ( flyingDist < unitNode._cost ) ) {
@@ -219,7 +219,7 @@ namespace Battle
                 const Cell * fromCell = Board::GetCell( fromNode );
                 assert( fromCell != nullptr );
 
-                Indexes availableMoves;
+                AroundIndexes availableMoves;
 
                 if ( !unitIsWide ) {
                     availableMoves = Board::GetAroundIndexes( fromNode );
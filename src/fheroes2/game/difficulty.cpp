@@ -141,3 +141,18 @@ double Difficulty::GetAIRetreatRatio( int difficulty )
     }
     return 100.0 / 6.0;
 }
+
+uint32_t Difficulty::GetAIBuildingPlanningDays( int difficulty )
+{
+    switch ( difficulty ) {
+    case Difficulty::EASY:
+        return 0;
+    case Difficulty::NORMAL:
+        return 1;
+    case Difficulty::HARD:
+        return 2;
+    default:
+        break;
+    }
+    return 3;
+}
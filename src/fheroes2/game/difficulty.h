@@ -23,6 +23,7 @@
 #ifndef H2DIFFICULTY_H
 #define H2DIFFICULTY_H
 
+#include <cstdint>
 #include <string>
 
 namespace Difficulty
@@ -43,6 +44,9 @@ namespace Difficulty
     double GetUnitGrowthBonusForAI( int difficulty );
     int GetHeroMovementBonus( int difficulty );
     double GetAIRetreatRatio( int difficulty );
+
+    // Returns the number of days of kingdom income that the AI takes into account when it decides to save resources for a more important building.
+    uint32_t GetAIBuildingPlanningDays( int difficulty );
 }
 
 #endif
@@ -46,6 +46,7 @@
 #endif
 
 #include "agg.h"
+#include "agg_image.h"
 #include "audio_manager.h"
 #include "bin_info.h"
 #include "core.h"
@@ -191,16 +192,6 @@ namespace
         DataInitializer & operator=( const DataInitializer & ) = delete;
         ~DataInitializer() = default;
 
-        const std::string & getOriginalAGGFilePath() const
-        {
-            return _aggInitializer->getOriginalAGGFilePath();
-        }
-
-        const std::string & getExpansionAGGFilePath() const
-        {
-            return _aggInitializer->getExpansionAGGFilePath();
-        }
-
     private:
         std::unique_ptr<AGG::AGGInitializer> _aggInitializer;
         std::unique_ptr<fheroes2::h2d::H2DInitializer> _h2dInitializer;
@@ -256,6 +247,7 @@ int main( int argc, char ** argv )
 
         const DisplayInitializer displayInitializer;
         const DataInitializer dataInitializer;
+        const fheroes2::AGG::ICNCacheInitializer icnCacheInitializer;
 
         ListFiles midiSoundFonts;
 
@@ -268,7 +260,7 @@ int main( int argc, char ** argv )
         }
 #endif
 
-        const AudioManager::AudioInitializer audioInitializer( dataInitializer.getOriginalAGGFilePath(), dataInitializer.getExpansionAGGFilePath(), midiSoundFonts );
+        const AudioManager::AudioInitializer audioInitializer( midiSoundFonts );
 
         // Load palette.
         fheroes2::setGamePalette( AGG::getDataFromAggFile( "KB.PAL" ) );
@@ -51,6 +51,10 @@ namespace
     const uint16_t SAV2ID2 = 0xFF02;
     const uint16_t SAV2ID3 = 0xFF03;
 
+    // zlib compression levels used for save files.
+    const int saveCompressionLevel = 6;
+    const int autosaveCompressionLevel = 1;
+
     struct HeaderSAV
     {
         enum
@@ -120,9 +124,15 @@ bool Game::Save( const std::string & fn )
        << HeaderSAV( conf.CurrentFileInfo(), conf.GameType() );
     fs.close();
 
-    ZStreamFile fz;
+    ZStreamWriter fz;
     fz.setbigendian( true );
 
+    // Autosave happens every turn so it favors speed over the file size.
+    if ( !fz.open( fn, true, autosave ? autosaveCompressionLevel : saveCompressionLevel ) ) {
+        DEBUG_LOG( DBG_GAME, DBG_WARN, fn << ", error open" )
+        return false;
+    }
+
     // zip game data content
     fz << loadver << World::Get() << Settings::Get() << GameOver::Result::Get();
 
@@ -131,7 +141,7 @@ bool Game::Save( const std::string & fn )
 
     fz << SAV2ID3; // eof marker
 
-    return !fz.fail() && fz.write( fn, true );
+    return fz.close();
 }
 
 fheroes2::GameMode Game::Load( const std::string & fn )
@@ -182,10 +192,10 @@ fheroes2::GameMode Game::Load( const std::string & fn )
         return fheroes2::GameMode::CANCEL;
     }
 
-    ZStreamFile fz;
+    ZStreamReader fz;
     fz.setbigendian( true );
 
-    if ( !fz.read( fn, offset ) ) {
+    if ( !fz.open( fn, offset ) ) {
         DEBUG_LOG( DBG_GAME, DBG_WARN, ", uncompress: error" )
         return fheroes2::GameMode::CANCEL;
     }
@@ -77,6 +77,14 @@ namespace
         QUIT_DEFAULT = 17
     };
 
+    // Images which are used in the most common game screens right after leaving Main Menu. They are decoded in background while a user
+    // interacts with Main Menu to avoid delays on the first opening of these screens.
+    const std::vector<int> mainMenuPreloadedIcnId{ ICN::ADVBORD,  ICN::ADVBTNS,  ICN::HEROBKG,  ICN::HEROEXTE, ICN::TOWNBKG0, ICN::TOWNBKG1,
+                                                   ICN::TOWNBKG2, ICN::TOWNBKG3, ICN::TOWNBKG4, ICN::TOWNBKG5, ICN::CSTLBARB, ICN::CSTLKNGT,
+                                                   ICN::CSTLNECR, ICN::CSTLSORC, ICN::CSTLWRLK, ICN::CSTLWZRD, ICN::CMBTMISC, ICN::TEXTBAR,
+                                                   ICN::STONEBAK, ICN::OVERBACK, ICN::BOOK,     ICN::SPELLS,   ICN::MINIPORT, ICN::PORTMEDI,
+                                                   ICN::MONS32,   ICN::RESOURCE, ICN::REQUEST,  ICN::REQUESTS, ICN::SCENIBKG, ICN::NGHSBKG };
+
     void outputMainMenuInTextSupportMode()
     {
         START_TEXT_SUPPORT_MODE
@@ -195,6 +203,8 @@ fheroes2::GameMode Game::MainMenu( bool isFirstGameRun )
 
     // image background
     fheroes2::drawMainMenuScreen();
+
+    fheroes2::AGG::preloadICNs( mainMenuPreloadedIcnId );
     if ( isFirstGameRun ) {
         fheroes2::selectLanguage( fheroes2::getSupportedLanguages(), fheroes2::getLanguageFromAbbreviation( conf.getGameLanguage() ) );
 
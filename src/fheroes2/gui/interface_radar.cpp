@@ -23,7 +23,7 @@
 
 #include "interface_radar.h"
 
-#include <utility>
+#include <cstddef>
 
 #include "agg_image.h"
 #include "castle.h"
@@ -51,19 +51,6 @@
 
 namespace
 {
-    int GetChunkSize( int size1, int size2 )
-    {
-        if ( size1 > size2 ) {
-            const int res = size1 / size2;
-            if ( ( size1 % size2 ) * 10 > size2 ) {
-                return res + 1;
-            }
-            return res;
-        }
-
-        return 1;
-    }
-
     enum
     {
         RADARCOLOR = 0xB5, // index palette
@@ -148,12 +135,30 @@ namespace
 
         return false;
     }
+
+    uint8_t getTerrainColor( const Maps::Tiles & tile )
+    {
+        if ( tile.isRoad() ) {
+            return COLOR_ROAD;
+        }
+
+        uint8_t color = GetPaletteIndexFromGround( tile.GetGround() );
+
+        const MP2::MapObjectType objectType = tile.GetObject();
+        if ( objectType == MP2::OBJ_MOUNTS || objectType == MP2::OBJ_TREES )
+            color += 3;
+
+        return color;
+    }
 }
 
 Interface::Radar::Radar( Basic & basic )
     : BorderWindow( { 0, 0, RADARWIDTH, RADARWIDTH } )
     , radarType( RadarType::WorldMap )
     , interface( basic )
+    , _tileColorsPlayerColors( Color::NONE )
+    , _tileColorsMode( ViewWorldMode::OnlyVisible )
+    , _isFullUpdateRequired( true )
     , hide( true )
     , _mouseDraggingMovement( false )
 {}
@@ -162,7 +167,12 @@ Interface::Radar::Radar( const Radar & radar, const fheroes2::Display & display
     : BorderWindow( { display.width() - BORDERWIDTH - RADARWIDTH, BORDERWIDTH, RADARWIDTH, RADARWIDTH } )
     , radarType( RadarType::ViewWorld )
     , interface( radar.interface )
+    , _tileColors( radar._tileColors )
+    , _tileColorsPlayerColors( radar._tileColorsPlayerColors )
+    , _tileColorsMode( radar._tileColorsMode )
+    , _isFullUpdateRequired( true )
     , spriteArea( radar.spriteArea )
+    , offset( radar.offset )
     , hide( false )
     , _mouseDraggingMovement( false )
 {}
@@ -188,146 +198,79 @@ void Interface::Radar::Generate()
     const int32_t worldWidth = world.w();
     const int32_t worldHeight = world.h();
 
-    spriteArea.resize( worldWidth, worldHeight );
-    spriteArea.reset();
+    fheroes2::Size new_sz( area.width, area.height );
+    offset = { 0, 0 };
 
-    for ( int32_t y = 0; y < worldHeight; ++y ) {
-        for ( int32_t x = 0; x < worldWidth; ++x ) {
-            const Maps::Tiles & tile = world.GetTiles( x, y );
-            uint8_t color = 0;
+    if ( worldWidth < worldHeight ) {
+        new_sz.width = ( worldWidth * area.height ) / worldHeight;
+        offset.x = ( area.width - new_sz.width ) / 2;
+    }
+    else if ( worldWidth > worldHeight ) {
+        new_sz.height = ( worldHeight * area.width ) / worldWidth;
+        offset.y = ( area.height - new_sz.height ) / 2;
+    }
 
-            if ( tile.isRoad() ) {
-                color = COLOR_ROAD;
-            }
-            else {
-                color = GetPaletteIndexFromGround( tile.GetGround() );
+    spriteArea.resize( new_sz.width, new_sz.height );
+    spriteArea.fill( 0 );
 
-                const MP2::MapObjectType objectType = tile.GetObject();
-                if ( objectType == MP2::OBJ_MOUNTS || objectType == MP2::OBJ_TREES )
-                    color += 3;
-            }
+    _tileColors.assign( static_cast<size_t>( worldWidth ) * worldHeight, 0 );
+    _isFullUpdateRequired = true;
+}
 
-            fheroes2::SetPixel( spriteArea, x, y, color );
-        }
+void Interface::Radar::updateTileColors( const int playerColors, const ViewWorldMode mode )
+{
+    const int32_t worldWidth = world.w();
+    const int32_t worldHeight = world.h();
+
+    if ( _tileColors.size() != static_cast<size_t>( worldWidth ) * worldHeight || spriteArea.empty() ) {
+        // The radar has not been generated for the current map.
+        return;
     }
 
-    if ( spriteArea.width() != area.width || spriteArea.height() != area.height ) {
-        fheroes2::Size new_sz;
+    const fheroes2::Rect mapArea( 0, 0, worldWidth, worldHeight );
 
-        if ( worldWidth < worldHeight ) {
-            new_sz.width = ( worldWidth * area.height ) / worldHeight;
-            new_sz.height = area.height;
-            offset.x = ( area.width - new_sz.width ) / 2;
-            offset.y = 0;
-        }
-        else if ( worldWidth > worldHeight ) {
-            new_sz.width = area.width;
-            new_sz.height = ( worldHeight * area.width ) / worldWidth;
-            offset.x = 0;
-            offset.y = ( area.height - new_sz.height ) / 2;
-        }
-        else {
-            new_sz.width = area.width;
-            new_sz.height = area.height;
-        }
+    fheroes2::Rect roi;
 
-        fheroes2::Image resized( new_sz.width, new_sz.height );
-        fheroes2::Resize( spriteArea, resized );
-        spriteArea = std::move( resized );
+    // Only the radar of the main game window keeps track of changes on the map. The View World radar is always generated from scratch.
+    if ( radarType == RadarType::WorldMap ) {
+        roi = world.takeRadarUpdateArea();
     }
-}
-
-void Interface::Radar::SetRedraw() const
-{
-    interface.SetRedraw( REDRAW_RADAR );
-}
 
-void Interface::Radar::Redraw()
-{
-    const Settings & conf = Settings::Get();
-    const bool hideInterface = conf.ExtGameHideInterface();
+    if ( _isFullUpdateRequired || playerColors != _tileColorsPlayerColors || mode != _tileColorsMode ) {
+        _isFullUpdateRequired = false;
+        _tileColorsPlayerColors = playerColors;
+        _tileColorsMode = mode;
 
-    if ( hideInterface && conf.ShowRadar() ) {
-        BorderWindow::Redraw();
+        roi = mapArea;
     }
+    else {
+        roi = mapArea ^ roi;
 
-    if ( !hideInterface || conf.ShowRadar() ) {
-        fheroes2::Display & display = fheroes2::Display::instance();
-        const fheroes2::Rect & rect = GetArea();
-        if ( hide ) {
-            fheroes2::Blit( fheroes2::AGG::GetICN( ( conf.ExtGameEvilInterface() ? ICN::HEROLOGE : ICN::HEROLOGO ), 0 ), display, rect.x, rect.y );
-        }
-        else {
-            cursorArea.hide();
-            fheroes2::Blit( spriteArea, display, rect.x + offset.x, rect.y + offset.y );
-            RedrawObjects( Players::FriendColors(), ViewWorldMode::OnlyVisible );
-            cursorArea.show();
-            RedrawCursor();
+        if ( roi.width <= 0 || roi.height <= 0 ) {
+            // Nothing has changed.
+            return;
         }
     }
-}
-
-void Interface::Radar::RedrawForViewWorld( const ViewWorld::ZoomROIs & roi, const ViewWorldMode mode )
-{
-    fheroes2::Display & display = fheroes2::Display::instance();
-    const fheroes2::Rect & rect = GetArea();
-    cursorArea.hide();
-    fheroes2::Blit( spriteArea, display, rect.x + offset.x, rect.y + offset.y );
-    RedrawObjects( Players::FriendColors(), mode );
-    const fheroes2::Rect roiInTiles = roi.GetROIinTiles();
-    cursorArea.show();
-    RedrawCursor( &roiInTiles );
-}
 
-void Interface::Radar::RedrawObjects( int color, ViewWorldMode flags ) const
-{
 #ifdef WITH_DEBUG
-    const bool revealAll = ( flags == ViewWorldMode::ViewAll ) || IS_DEVEL();
+    const bool revealAll = ( mode == ViewWorldMode::ViewAll ) || IS_DEVEL();
 #else
-    const bool revealAll = flags == ViewWorldMode::ViewAll;
+    const bool revealAll = mode == ViewWorldMode::ViewAll;
 #endif
 
-    const bool revealMines = revealAll || ( flags == ViewWorldMode::ViewMines );
-    const bool revealHeroes = revealAll || ( flags == ViewWorldMode::ViewHeroes );
-    const bool revealTowns = revealAll || ( flags == ViewWorldMode::ViewTowns );
-    const bool revealArtifacts = revealAll || ( flags == ViewWorldMode::ViewArtifacts );
-    const bool revealResources = revealAll || ( flags == ViewWorldMode::ViewResources );
-    const bool revealOnlyVisible = revealAll || ( flags == ViewWorldMode::OnlyVisible );
+    const bool revealMines = revealAll || ( mode == ViewWorldMode::ViewMines );
+    const bool revealHeroes = revealAll || ( mode == ViewWorldMode::ViewHeroes );
+    const bool revealTowns = revealAll || ( mode == ViewWorldMode::ViewTowns );
+    const bool revealArtifacts = revealAll || ( mode == ViewWorldMode::ViewArtifacts );
+    const bool revealResources = revealAll || ( mode == ViewWorldMode::ViewResources );
+    const bool revealOnlyVisible = revealAll || ( mode == ViewWorldMode::OnlyVisible );
 
-    const fheroes2::Rect & rect = GetArea();
+    for ( int32_t y = roi.y; y < roi.y + roi.height; ++y ) {
+        int32_t tileIndex = y * worldWidth + roi.x;
 
-    fheroes2::Display & display = fheroes2::Display::instance();
-
-    const int32_t worldWidth = world.w();
-    const int32_t worldHeight = world.h();
-    const int areaw = rect.width - 2 * offset.x;
-    const int areah = rect.height - 2 * offset.y;
-
-    int stepx = worldWidth / rect.width;
-    int stepy = worldHeight / rect.height;
-
-    if ( 0 == stepx )
-        stepx = 1;
-    if ( 0 == stepy )
-        stepy = 1;
-
-    int sw = 0;
-
-    if ( worldWidth >= worldHeight )
-        sw = GetChunkSize( areaw, worldWidth );
-    else
-        sw = GetChunkSize( areah, worldHeight );
-
-    const int32_t offsetX = rect.x + offset.x;
-    const int32_t offsetY = rect.y + offset.y;
-
-    for ( int32_t y = 0; y < worldHeight; y += stepy ) {
-        const int dsty = offsetY + ( y * areah ) / worldHeight; // calculate once per row
-
-        int tileIndex = y * worldWidth;
-        for ( int32_t x = 0; x < worldWidth; x += stepx, tileIndex += stepx ) {
+        for ( int32_t x = roi.x; x < roi.x + roi.width; ++x, ++tileIndex ) {
             const Maps::Tiles & tile = world.GetTiles( tileIndex );
-            const bool visibleTile = revealAll || !tile.isFog( color );
+            const bool visibleTile = revealAll || !tile.isFog( playerColors );
 
             uint8_t fillColor = 0;
 
@@ -377,7 +320,7 @@ void Interface::Radar::RedrawObjects( int color, ViewWorldMode flags ) const
                 // Castles and Towns can be partially covered by other non-action objects so we need to rely on special storage of castle's tiles.
                 if ( visibleTile ) {
                     if ( !getCastleColor( fillColor, tile.GetCenter() ) ) {
-                        continue;
+                        fillColor = getTerrainColor( tile );
                     }
                 }
                 else if ( revealTowns ) {
@@ -385,18 +328,83 @@ void Interface::Radar::RedrawObjects( int color, ViewWorldMode flags ) const
                 }
             }
 
-            const int dstx = offsetX + ( x * areaw ) / worldWidth;
+            _tileColors[tileIndex] = fillColor;
+        }
+    }
 
-            if ( sw > 1 ) {
-                fheroes2::Fill( display, dstx, dsty, sw, sw, fillColor );
-            }
-            else {
-                fheroes2::SetPixel( display, dstx, dsty, fillColor );
-            }
+    scaleTileColors( roi );
+}
+
+void Interface::Radar::scaleTileColors( const fheroes2::Rect & roi )
+{
+    const int32_t worldWidth = world.w();
+    const int32_t worldHeight = world.h();
+    const int32_t imageWidth = spriteArea.width();
+    const int32_t imageHeight = spriteArea.height();
+
+    // Every pixel of the radar image takes the color of the nearest tile: ( x * worldWidth / imageWidth, y * worldHeight / imageHeight ).
+    // So only the pixels in the range [ ceil( roi.x * imageWidth / worldWidth ), ceil( ( roi.x + roi.width ) * imageWidth / worldWidth ) )
+    // are affected by the given tiles and the same applies to the vertical axis.
+    const int32_t minX = ( roi.x * imageWidth + worldWidth - 1 ) / worldWidth;
+    const int32_t maxX = ( ( roi.x + roi.width ) * imageWidth + worldWidth - 1 ) / worldWidth;
+    const int32_t minY = ( roi.y * imageHeight + worldHeight - 1 ) / worldHeight;
+    const int32_t maxY = ( ( roi.y + roi.height ) * imageHeight + worldHeight - 1 ) / worldHeight;
+
+    uint8_t * imageY = spriteArea.image() + minY * imageWidth;
+
+    for ( int32_t y = minY; y < maxY; ++y, imageY += imageWidth ) {
+        const uint8_t * tileColorsY = _tileColors.data() + ( y * worldHeight / imageHeight ) * worldWidth;
+
+        for ( int32_t x = minX; x < maxX; ++x ) {
+            imageY[x] = tileColorsY[x * worldWidth / imageWidth];
         }
     }
 }
 
+void Interface::Radar::SetRedraw() const
+{
+    interface.SetRedraw( REDRAW_RADAR );
+}
+
+void Interface::Radar::Redraw()
+{
+    const Settings & conf = Settings::Get();
+    const bool hideInterface = conf.ExtGameHideInterface();
+
+    if ( hideInterface && conf.ShowRadar() ) {
+        BorderWindow::Redraw();
+    }
+
+    if ( !hideInterface || conf.ShowRadar() ) {
+        fheroes2::Display & display = fheroes2::Display::instance();
+        const fheroes2::Rect & rect = GetArea();
+        if ( hide ) {
+            fheroes2::Blit( fheroes2::AGG::GetICN( ( conf.ExtGameEvilInterface() ? ICN::HEROLOGE : ICN::HEROLOGO ), 0 ), display, rect.x, rect.y );
+        }
+        else {
+            updateTileColors( Players::FriendColors(), ViewWorldMode::OnlyVisible );
+
+            cursorArea.hide();
+            fheroes2::Blit( spriteArea, display, rect.x + offset.x, rect.y + offset.y );
+            cursorArea.show();
+            RedrawCursor();
+        }
+    }
+}
+
+void Interface::Radar::RedrawForViewWorld( const ViewWorld::ZoomROIs & roi, const ViewWorldMode mode )
+{
+    updateTileColors( Players::FriendColors(), mode );
+
+    fheroes2::Display & display = fheroes2::Display::instance();
+    const fheroes2::Rect & rect = GetArea();
+    cursorArea.hide();
+    fheroes2::Blit( spriteArea, display, rect.x + offset.x, rect.y + offset.y );
+    const fheroes2::Rect roiInTiles = roi.GetROIinTiles();
+    cursorArea.show();
+    RedrawCursor( &roiInTiles );
+}
+
 // Redraw radar cursor. RoiRectangle is a rectangle in tile unit of the current radar view.
 void Interface::Radar::RedrawCursor( const fheroes2::Rect * roiRectangle /* =nullptr */ )
 {
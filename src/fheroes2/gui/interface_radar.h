@@ -25,6 +25,7 @@
 #define H2INTERFACE_RADAR_H
 
 #include <cstdint>
+#include <vector>
 
 #include "image.h"
 #include "interface_border.h"
@@ -87,12 +88,24 @@ namespace Interface
         // Do not call this method directly, use Interface::Basic::Redraw() instead
         // to avoid issues in the "no interface" mode
         void Redraw();
-        void RedrawObjects( int color, ViewWorldMode flags ) const;
         void RedrawCursor( const fheroes2::Rect * roiRectangle = nullptr );
 
+        // Updates colors of the changed tiles for the given player colors and the mode. All tiles are updated only
+        // if the player colors or the mode differ from the ones used for the previous update or a full update is requested.
+        void updateTileColors( const int playerColors, const ViewWorldMode mode );
+        // Scales the given area of the map (in tiles) from the tile colors to the radar image.
+        void scaleTileColors( const fheroes2::Rect & roi );
+
         RadarType radarType;
         Basic & interface;
 
+        // Colors of all map tiles, one value per tile.
+        std::vector<uint8_t> _tileColors;
+        int _tileColorsPlayerColors;
+        ViewWorldMode _tileColorsMode;
+        bool _isFullUpdateRequired;
+
+        // The radar image scaled to the radar area.
         fheroes2::Image spriteArea;
         fheroes2::MovableSprite cursorArea;
         fheroes2::Point offset;
@@ -272,6 +272,41 @@ namespace
         offset->x += lineWidth;
     }
 
+    void updateLayout( const std::deque<fheroes2::Point> & offsets, const int32_t maxWidth, const uint32_t fontVersion, fheroes2::TextLayoutCache & layout )
+    {
+        layout.maxWidth = maxWidth;
+        layout.fontVersion = fontVersion;
+        layout.rowCount = static_cast<int32_t>( offsets.size() );
+        layout.maxRowWidth = 0;
+        layout.lastRowOffsetY = offsets.empty() ? 0 : offsets.back().y;
+        layout.drawWidth = -1;
+
+        for ( const fheroes2::Point & point : offsets ) {
+            layout.maxRowWidth = std::max( layout.maxRowWidth, point.x );
+        }
+    }
+
+    // Find the smallest width of a line which does not increase the number of rows of multi-line text so the text looks evenly.
+    template <typename RowCounter>
+    int32_t getEvenRowWidth( const int32_t maxWidth, const int32_t rowCount, const RowCounter & getRowCount )
+    {
+        int32_t correctedWidth = maxWidth;
+        int32_t startWidth = 1;
+        int32_t endWidth = maxWidth;
+        while ( startWidth + 1 < endWidth ) {
+            const int32_t currentWidth = ( endWidth + startWidth ) / 2;
+            if ( getRowCount( currentWidth ) > rowCount ) {
+                startWidth = currentWidth;
+                continue;
+            }
+
+            correctedWidth = currentWidth;
+            endWidth = currentWidth;
+        }
+
+        return correctedWidth;
+    }
+
     int32_t render( const uint8_t * data, const int32_t size, const int32_t x, const int32_t y, fheroes2::Image & output, const fheroes2::FontType & fontType )
     {
         assert( data != nullptr && size > 0 && !output.empty() );
@@ -457,17 +492,7 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t fontHeight = getFontHeight( _fontType.size );
-
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
-
-        int32_t maxRowWidth = offsets.front().x;
-        for ( const Point & point : offsets ) {
-            maxRowWidth = std::max( maxRowWidth, point.x );
-        }
-
-        return maxRowWidth;
+        return _getLayout( maxWidth ).maxRowWidth;
     }
 
     int32_t Text::height( const int32_t maxWidth ) const
@@ -476,12 +501,7 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t fontHeight = getFontHeight( _fontType.size );
-
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
-
-        return offsets.back().y + fontHeight;
+        return _getLayout( maxWidth ).lastRowOffsetY + getFontHeight( _fontType.size );
     }
 
     int32_t Text::rows( const int32_t maxWidth ) const
@@ -490,12 +510,7 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t fontHeight = getFontHeight( _fontType.size );
-
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
-
-        return offsets.back().y / fontHeight + 1;
+        return _getLayout( maxWidth ).lastRowOffsetY / getFontHeight( _fontType.size ) + 1;
     }
 
     void Text::draw( const int32_t x, const int32_t y, Image & output ) const
@@ -523,40 +538,28 @@ namespace fheroes2
 
         const int32_t fontHeight = getFontHeight( _fontType.size );
 
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
-
-        int32_t xOffset = 0;
-        int32_t correctedWidth = maxWidth;
-        if ( offsets.size() > 1 ) {
-            // This is a multi-line message. Optimize it to fit the text evenly.
-            int32_t startWidth = 1;
-            int32_t endWidth = maxWidth;
-            while ( startWidth + 1 < endWidth ) {
-                const int32_t currentWidth = ( endWidth + startWidth ) / 2;
-                std::deque<Point> tempOffsets;
-                getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), currentWidth, _fontType, fontHeight,
-                                 tempOffsets );
-
-                if ( tempOffsets.size() > offsets.size() ) {
-                    startWidth = currentWidth;
-                    continue;
-                }
-
-                correctedWidth = currentWidth;
-                endWidth = currentWidth;
+        const TextLayoutCache & layout = _getLayout( maxWidth );
+        if ( layout.drawWidth < 0 ) {
+            if ( layout.rowCount > 1 ) {
+                // This is a multi-line message. Optimize it to fit the text evenly.
+                _layout.drawWidth = getEvenRowWidth( maxWidth, layout.rowCount, [this, fontHeight]( const int32_t currentWidth ) {
+                    std::deque<Point> tempOffsets;
+                    getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), currentWidth, _fontType, fontHeight,
+                                     tempOffsets );
+                    return static_cast<int32_t>( tempOffsets.size() );
+                } );
+            }
+            else {
+                // This is a single-line message. Find its length and center it according to the maximum width.
+                _layout.drawWidth = width();
+                assert( _layout.drawWidth <= maxWidth );
             }
-
-            xOffset = ( maxWidth - correctedWidth ) / 2;
-        }
-        else {
-            // This is a single-line message. Find its length and center it according to the maximum width.
-            correctedWidth = width();
-            assert( correctedWidth <= maxWidth );
-            xOffset = ( maxWidth - correctedWidth ) / 2;
         }
 
-        offsets.clear();
+        const int32_t correctedWidth = layout.drawWidth;
+        const int32_t xOffset = ( maxWidth - correctedWidth ) / 2;
+
+        std::deque<Point> offsets;
         render( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), x + xOffset, y, correctedWidth, output, _fontType, fontHeight,
                 true, offsets );
     }
@@ -570,12 +573,14 @@ namespace fheroes2
     {
         _text = text;
         _fontType = fontType;
+        _layout = {};
     }
 
     void Text::set( std::string && text, const FontType fontType )
     {
         _text = std::move( text );
         _fontType = fontType;
+        _layout = {};
     }
 
     void Text::fitToOneRow( const int32_t maxWidth )
@@ -600,6 +605,7 @@ namespace fheroes2
 
         _text.resize( maxCharacterCount );
         _text += truncatedEnding;
+        _layout = {};
     }
 
     std::string Text::text() const
@@ -607,12 +613,28 @@ namespace fheroes2
         return _text;
     }
 
+    const TextLayoutCache & Text::_getLayout( const int32_t maxWidth ) const
+    {
+        const uint32_t fontVersion = AGG::getFontResourceVersion();
+        if ( _layout.maxWidth == maxWidth && _layout.fontVersion == fontVersion ) {
+            return _layout;
+        }
+
+        std::deque<Point> offsets;
+        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType,
+                         getFontHeight( _fontType.size ), offsets );
+
+        updateLayout( offsets, maxWidth, fontVersion, _layout );
+        return _layout;
+    }
+
     MultiFontText::~MultiFontText() = default;
 
     void MultiFontText::add( const Text & text )
     {
         if ( !text._text.empty() ) {
             _texts.emplace_back( text );
+            _layout = {};
         }
     }
 
@@ -620,6 +642,7 @@ namespace fheroes2
     {
         if ( !text._text.empty() ) {
             _texts.emplace_back( std::move( text ) );
+            _layout = {};
         }
     }
 
@@ -649,32 +672,20 @@ namespace fheroes2
 
     int32_t MultiFontText::width( const int32_t maxWidth ) const
     {
-        const int32_t maxFontHeight = height();
-
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
-        }
-
-        int32_t maxRowWidth = offsets.front().x;
-        for ( const Point & point : offsets ) {
-            maxRowWidth = std::max( maxRowWidth, point.x );
+        if ( _texts.empty() ) {
+            return 0;
         }
 
-        return maxRowWidth;
+        return _getLayout( maxWidth ).maxRowWidth;
     }
 
     int32_t MultiFontText::height( const int32_t maxWidth ) const
     {
-        const int32_t maxFontHeight = height();
-
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
+        if ( _texts.empty() ) {
+            return 0;
         }
-        return offsets.back().y + maxFontHeight;
+
+        return _getLayout( maxWidth ).lastRowOffsetY + height();
     }
 
     int32_t MultiFontText::rows( const int32_t maxWidth ) const
@@ -683,23 +694,7 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t maxFontHeight = height();
-
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            if ( text._text.empty() ) {
-                continue;
-            }
-
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
-        }
-
-        if ( offsets.empty() ) {
-            return 0;
-        }
-
-        return offsets.back().y / maxFontHeight + 1;
+        return _getLayout( maxWidth ).lastRowOffsetY / height() + 1;
     }
 
     void MultiFontText::draw( const int32_t x, const int32_t y, Image & output ) const
@@ -734,44 +729,36 @@ namespace fheroes2
 
         const int32_t maxFontHeight = height();
 
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
+        auto getOffsets = [this, maxFontHeight]( const int32_t currentWidth, std::deque<Point> & offsets ) {
+            for ( const Text & text : _texts ) {
+                getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), currentWidth, text._fontType,
+                                 maxFontHeight, offsets );
+            }
+        };
+
+        const TextLayoutCache & layout = _getLayout( maxWidth );
+        if ( layout.drawWidth < 0 ) {
+            if ( layout.rowCount > 1 ) {
+                // This is a multi-line message. Optimize it to fit the text evenly.
+                _layout.drawWidth = getEvenRowWidth( maxWidth, layout.rowCount, [&getOffsets]( const int32_t currentWidth ) {
+                    std::deque<Point> tempOffsets;
+                    getOffsets( currentWidth, tempOffsets );
+                    return static_cast<int32_t>( tempOffsets.size() );
+                } );
+            }
+            else {
+                // This is a single-line message. Find its length and center it according to the maximum width.
+                _layout.drawWidth = width();
+                assert( _layout.drawWidth <= maxWidth );
+            }
         }
 
-        int32_t xOffset = 0;
-        int32_t correctedWidth = maxWidth;
-        if ( offsets.size() > 1 ) {
-            // This is a multi-line message. Optimize it to fit the text evenly.
-            int32_t startWidth = 1;
-            int32_t endWidth = maxWidth;
-            while ( startWidth + 1 < endWidth ) {
-                const int32_t currentWidth = ( endWidth + startWidth ) / 2;
-                std::deque<Point> tempOffsets;
-                for ( const Text & text : _texts ) {
-                    getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), currentWidth, text._fontType,
-                                     maxFontHeight, tempOffsets );
-                }
-
-                if ( tempOffsets.size() > offsets.size() ) {
-                    startWidth = currentWidth;
-                    continue;
-                }
-
-                correctedWidth = currentWidth;
-                endWidth = currentWidth;
-                std::swap( offsets, tempOffsets );
-            }
+        const int32_t correctedWidth = layout.drawWidth;
+        const int32_t xOffset = ( maxWidth - correctedWidth ) / 2;
 
-            xOffset = ( maxWidth - correctedWidth ) / 2;
-        }
-        else {
-            // This is a single-line message. Find its length and center it according to the maximum width.
-            correctedWidth = width();
-            assert( correctedWidth <= maxWidth );
-            xOffset = ( maxWidth - correctedWidth ) / 2;
-        }
+        // Rendering modifies offsets so they are calculated every time but only for the final width of a line.
+        std::deque<Point> offsets;
+        getOffsets( layout.rowCount > 1 ? correctedWidth : maxWidth, offsets );
 
         for ( Point & point : offsets ) {
             point.x = ( correctedWidth - point.x ) / 2;
@@ -799,6 +786,25 @@ namespace fheroes2
         return output;
     }
 
+    const TextLayoutCache & MultiFontText::_getLayout( const int32_t maxWidth ) const
+    {
+        const uint32_t fontVersion = AGG::getFontResourceVersion();
+        if ( _layout.maxWidth == maxWidth && _layout.fontVersion == fontVersion ) {
+            return _layout;
+        }
+
+        const int32_t maxFontHeight = height();
+
+        std::deque<Point> offsets;
+        for ( const Text & text : _texts ) {
+            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
+                             offsets );
+        }
+
+        updateLayout( offsets, maxWidth, fontVersion, _layout );
+        return _layout;
+    }
+
     bool isFontAvailable( const std::string & text, const FontType fontType )
     {
         if ( text.empty() ) {
@@ -84,6 +84,22 @@ namespace fheroes2
         }
     };
 
+    // Results of multi-line text layout calculation for a particular maximum width of a line. Text classes keep the last calculated layout
+    // since dialogs usually request width, height and rendering of the same text with the same maximum width one after another.
+    struct TextLayoutCache
+    {
+        // Maximum width of a line for which the layout was calculated. 0 means that there is no layout.
+        int32_t maxWidth{ 0 };
+        uint32_t fontVersion{ 0 };
+
+        int32_t rowCount{ 0 };
+        int32_t maxRowWidth{ 0 };
+        int32_t lastRowOffsetY{ 0 };
+
+        // Width of a line which evenly fits multi-line text during rendering. Negative if it has not been calculated yet.
+        int32_t drawWidth{ -1 };
+    };
+
     class TextBase
     {
     public:
@@ -158,6 +174,10 @@ namespace fheroes2
         std::string _text;
 
         FontType _fontType;
+
+        mutable TextLayoutCache _layout;
+
+        const TextLayoutCache & _getLayout( const int32_t maxWidth ) const;
     };
 
     class MultiFontText : public TextBase
@@ -186,6 +206,10 @@ namespace fheroes2
 
     private:
         std::vector<Text> _texts;
+
+        mutable TextLayoutCache _layout;
+
+        const TextLayoutCache & _getLayout( const int32_t maxWidth ) const;
     };
 
     // This function is usually useful for text generation on buttons as button font is a separate set of sprites.
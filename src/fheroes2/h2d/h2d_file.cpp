@@ -25,6 +25,7 @@
 #include <cstring>
 
 #include "image.h"
+#include "serialize.h"
 
 namespace
 {
@@ -41,40 +42,51 @@ namespace fheroes2
     bool H2RReader::open( const std::string & path )
     {
         _fileNameAndOffset.clear();
-        _fileStream.close();
+        _file.close();
 
-        if ( !_fileStream.open( path, "rb" ) ) {
+        if ( !_file.open( path ) ) {
             return false;
         }
 
-        const size_t fileSize = _fileStream.size();
+        const size_t fileSize = _file.size();
         if ( fileSize < minFileSize ) {
             return false;
         }
 
-        if ( _fileStream.get() != 'H' ) {
+        // The size of the file info section is not known in advance. H2D files are small so the whole file is accessed here:
+        // it costs nothing when the file is memory mapped.
+        const FileData header = _file.read( 0, fileSize );
+        if ( header.empty() ) {
             return false;
         }
-        if ( _fileStream.get() != '2' ) {
+
+        StreamBuf stream( header.data(), header.size() );
+
+        if ( stream.get() != 'H' ) {
             return false;
         }
-        if ( _fileStream.get() != 'D' ) {
+        if ( stream.get() != '2' ) {
             return false;
         }
-        if ( _fileStream.get() != '\0' ) {
+        if ( stream.get() != 'D' ) {
+            return false;
+        }
+        if ( stream.get() != '\0' ) {
             return false;
         }
 
-        const uint32_t fileCount = _fileStream.getLE32();
+        const uint32_t fileCount = stream.getLE32();
         if ( fileCount == 0 ) {
             return false;
         }
 
+        _fileNameAndOffset.reserve( fileCount );
+
         for ( uint32_t i = 0; i < fileCount; ++i ) {
-            const uint32_t offset = _fileStream.getLE32();
-            const uint32_t size = _fileStream.getLE32();
+            const uint32_t offset = stream.getLE32();
+            const uint32_t size = stream.getLE32();
             std::string name;
-            _fileStream >> name;
+            stream >> name;
             if ( size == 0 || offset + size > fileSize || name.empty() ) {
                 continue;
             }
@@ -85,15 +97,14 @@ namespace fheroes2
         return true;
     }
 
-    std::vector<uint8_t> H2RReader::getFile( const std::string & fileName )
+    FileData H2RReader::getFileData( const std::string & fileName ) const
     {
         const auto it = _fileNameAndOffset.find( fileName );
         if ( it == _fileNameAndOffset.end() ) {
-            return std::vector<uint8_t>();
+            return {};
         }
 
-        _fileStream.seek( it->second.first );
-        return _fileStream.getRaw( it->second.second );
+        return _file.read( it->second.first, it->second.second );
     }
 
     std::set<std::string> H2RReader::getAllFileNames() const
@@ -158,7 +169,7 @@ namespace fheroes2
         return result.second;
     }
 
-    bool H2Writer::add( H2RReader & reader )
+    bool H2Writer::add( const H2RReader & reader )
     {
         const std::set<std::string> names = reader.getAllFileNames();
 
@@ -171,15 +182,15 @@ namespace fheroes2
         return true;
     }
 
-    bool readImageFromH2D( H2RReader & reader, const std::string & name, Sprite & image )
+    bool readImageFromH2D( const H2RReader & reader, const std::string & name, Sprite & image )
     {
-        const std::vector<uint8_t> & data = reader.getFile( name );
+        const FileData data = reader.getFileData( name );
         if ( data.size() < 4 + 4 + 4 + 4 + 1 ) {
             // Empty or invalid image.
             return false;
         }
 
-        StreamBuf stream( data );
+        StreamBuf stream( data.data(), data.size() );
         const int32_t width = static_cast<int32_t>( stream.getLE32() );
         const int32_t height = static_cast<int32_t>( stream.getLE32() );
         const int32_t x = static_cast<int32_t>( stream.getLE32() );
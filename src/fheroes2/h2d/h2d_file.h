@@ -24,10 +24,11 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
-#include "serialize.h"
+#include "mapped_file.h"
 
 namespace fheroes2
 {
@@ -41,16 +42,22 @@ namespace fheroes2
         bool open( const std::string & path );
 
         // Returns non-empty vector if requested file exists.
-        std::vector<uint8_t> getFile( const std::string & fileName );
+        std::vector<uint8_t> getFile( const std::string & fileName ) const
+        {
+            return getFileData( fileName ).toVector();
+        }
+
+        // Returns data of the requested file without copying it when the archive is memory mapped.
+        // The returned object must not outlive this reader. This method is thread-safe.
+        FileData getFileData( const std::string & fileName ) const;
 
         std::set<std::string> getAllFileNames() const;
 
     private:
         // Relationship between file name in non-capital letters and its offset from the start of the archive.
-        std::map<std::string, std::pair<uint32_t, uint32_t>> _fileNameAndOffset;
+        std::unordered_map<std::string, std::pair<uint32_t, uint32_t>> _fileNameAndOffset;
 
-        // Stream for reading h2d file.
-        StreamFile _fileStream;
+        MappedFile _file;
     };
 
     // This class is not designed to be performance optimized as it will be used very rarely and out of game running session.
@@ -63,13 +70,13 @@ namespace fheroes2
         bool add( const std::string & name, const std::vector<uint8_t> & data );
 
         // Add all entries from a H2D reader.
-        bool add( H2RReader & reader );
+        bool add( const H2RReader & reader );
 
     private:
         std::map<std::string, std::vector<uint8_t>> _fileData;
     };
 
-    bool readImageFromH2D( H2RReader & reader, const std::string & name, Sprite & image );
+    bool readImageFromH2D( const H2RReader & reader, const std::string & name, Sprite & image );
 
     bool writeImageToH2D( H2Writer & writer, const std::string & name, const Sprite & image );
 }
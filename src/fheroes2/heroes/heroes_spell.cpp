@@ -297,7 +297,7 @@ namespace
 
         const int tilePassability = world.GetTiles( center ).GetPassable();
 
-        const MapsIndexes tilesAround = Maps::GetFreeIndexesAroundTile( center );
+        const Maps::AroundIndexes tilesAround = Maps::GetFreeIndexesAroundTile( center );
 
         std::vector<int32_t> possibleBoatPositions;
 
@@ -147,29 +147,28 @@ namespace
         }
     }
 
-    struct CacheForMapWithResources
+    // Cached world map for all zoom levels. The map is rendered in blocks of 18x18 tiles and a block is rendered only when some part of it
+    // has to be displayed for the first time, so opening the window does not require rendering of the whole map.
+    class CacheForMapWithResources
     {
-        std::vector<fheroes2::Image> cachedImages; // One image per zoom Level
-
+    public:
         CacheForMapWithResources() = delete;
 
-        // Compute complete world map, and save it for all zoom levels
         explicit CacheForMapWithResources( const ViewWorldMode viewMode )
+            : _blockImage( blockSizeX, blockSizeY )
+            , _gameArea( Interface::Basic::Get().GetGameArea() )
         {
 #ifdef VIEWWORLD_DEBUG_ZOOM_LEVEL
-            cachedImages.resize( 4 );
+            _cachedImages.resize( 4 );
 #else
-            cachedImages.resize( 3 );
+            _cachedImages.resize( 3 );
 #endif
 
-            for ( size_t i = 0; i < cachedImages.size(); ++i ) {
-                cachedImages[i].resize( world.w() * tileSizePerZoomLevel[i], world.h() * tileSizePerZoomLevel[i] );
-                cachedImages[i]._disableTransformLayer();
+            for ( size_t i = 0; i < _cachedImages.size(); ++i ) {
+                _cachedImages[i].resize( world.w() * tileSizePerZoomLevel[i], world.h() * tileSizePerZoomLevel[i] );
+                _cachedImages[i]._disableTransformLayer();
             }
 
-            const int32_t blockSizeX = TILEWIDTH * 18;
-            const int32_t blockSizeY = TILEWIDTH * 18;
-
             const int32_t worldWidthPixels = world.w() * TILEWIDTH;
             const int32_t worldHeightPixels = world.h() * TILEWIDTH;
 
@@ -177,50 +176,91 @@ namespace
             assert( worldWidthPixels % blockSizeX == 0 );
             assert( worldHeightPixels % blockSizeY == 0 );
 
-            // Create temporary image where we will draw blocks of the main map on
-            fheroes2::Image temporaryImg( blockSizeX, blockSizeY );
-            temporaryImg._disableTransformLayer();
+            _blockCountX = worldWidthPixels / blockSizeX;
+            _blockCountY = worldHeightPixels / blockSizeY;
+            _isBlockRendered.resize( static_cast<size_t>( _blockCountX ) * _blockCountY, 0 );
+
+            // Temporary image where we draw blocks of the main map on
+            _blockImage._disableTransformLayer();
 
-            Interface::GameArea gamearea = Interface::Basic::Get().GetGameArea();
-            gamearea.SetAreaPosition( 0, 0, blockSizeX, blockSizeY );
+            _gameArea.SetAreaPosition( 0, 0, blockSizeX, blockSizeY );
 
-            int drawingFlags = Interface::RedrawLevelType::LEVEL_ALL & ~Interface::RedrawLevelType::LEVEL_ROUTES;
+            _drawingFlags = Interface::RedrawLevelType::LEVEL_ALL & ~Interface::RedrawLevelType::LEVEL_ROUTES;
             if ( viewMode == ViewWorldMode::ViewAll ) {
-                drawingFlags &= ~Interface::RedrawLevelType::LEVEL_FOG;
+                _drawingFlags &= ~Interface::RedrawLevelType::LEVEL_FOG;
             }
             else if ( viewMode == ViewWorldMode::ViewTowns ) {
-                drawingFlags |= Interface::RedrawLevelType::LEVEL_TOWNS;
+                _drawingFlags |= Interface::RedrawLevelType::LEVEL_TOWNS;
             }
 
 #if !defined( SAVE_WORLD_MAP )
-            drawingFlags ^= Interface::RedrawLevelType::LEVEL_HEROES;
+            _drawingFlags ^= Interface::RedrawLevelType::LEVEL_HEROES;
+#endif
+
+#if defined( SAVE_WORLD_MAP )
+            getImage( 3, { 0, 0, _cachedImages[3].width(), _cachedImages[3].height() } );
+            fheroes2::Save( _cachedImages[3], Settings::Get().MapsName() + saveFilePrefix + ".bmp" );
 #endif
+        }
 
-            // Draw sub-blocks of the main map, and resize them to draw them on lower-res cached versions:
-            for ( int x = 0; x < worldWidthPixels; x += blockSizeX ) {
-                for ( int y = 0; y < worldHeightPixels; y += blockSizeY ) {
-                    gamearea.SetCenterInPixels( { x + blockSizeX / 2, y + blockSizeY / 2 } );
-                    gamearea.Redraw( temporaryImg, drawingFlags );
-
-                    for ( size_t i = 0; i < cachedImages.size(); ++i ) {
-                        const int blockSizeResizedX = blockSizeX * tileSizePerZoomLevel[i] / TILEWIDTH;
-                        const int blockSizeResizedY = blockSizeY * tileSizePerZoomLevel[i] / TILEWIDTH;
-                        fheroes2::Resize( temporaryImg, 0, 0, temporaryImg.width(), temporaryImg.height(), cachedImages[i], x * tileSizePerZoomLevel[i] / TILEWIDTH,
-                                          y * tileSizePerZoomLevel[i] / TILEWIDTH, blockSizeResizedX, blockSizeResizedY );
+        // Returns the world map image for the given zoom level. All blocks of the map which intersect with the given area (in pixels of this zoom level)
+        // are rendered if they haven't been rendered yet.
+        const fheroes2::Image & getImage( const int zoomLevel, const fheroes2::Rect & roi )
+        {
+            const int32_t resizedBlockSizeX = blockSizeX * tileSizePerZoomLevel[zoomLevel] / TILEWIDTH;
+            const int32_t resizedBlockSizeY = blockSizeY * tileSizePerZoomLevel[zoomLevel] / TILEWIDTH;
+
+            const int32_t minBlockX = std::max( roi.x / resizedBlockSizeX, 0 );
+            const int32_t minBlockY = std::max( roi.y / resizedBlockSizeY, 0 );
+            const int32_t maxBlockX = std::min( ( roi.x + roi.width - 1 ) / resizedBlockSizeX, _blockCountX - 1 );
+            const int32_t maxBlockY = std::min( ( roi.y + roi.height - 1 ) / resizedBlockSizeY, _blockCountY - 1 );
+
+            for ( int32_t blockY = minBlockY; blockY <= maxBlockY; ++blockY ) {
+                for ( int32_t blockX = minBlockX; blockX <= maxBlockX; ++blockX ) {
+                    uint8_t & isRendered = _isBlockRendered[blockY * _blockCountX + blockX];
+                    if ( isRendered == 0 ) {
+                        renderBlock( blockX, blockY );
+                        isRendered = 1;
                     }
                 }
             }
 
-#if defined( SAVE_WORLD_MAP )
-            fheroes2::Save( cachedImages[3], Settings::Get().MapsName() + saveFilePrefix + ".bmp" );
-#endif
+            return _cachedImages[zoomLevel];
         }
+
+    private:
+        static constexpr int32_t blockSizeX = TILEWIDTH * 18;
+        static constexpr int32_t blockSizeY = TILEWIDTH * 18;
+
+        // Draws a block of the main map and resizes it to draw it on lower-res cached versions.
+        void renderBlock( const int32_t blockX, const int32_t blockY )
+        {
+            const int32_t x = blockX * blockSizeX;
+            const int32_t y = blockY * blockSizeY;
+
+            _gameArea.SetCenterInPixels( { x + blockSizeX / 2, y + blockSizeY / 2 } );
+            _gameArea.Redraw( _blockImage, _drawingFlags );
+
+            for ( size_t i = 0; i < _cachedImages.size(); ++i ) {
+                const int blockSizeResizedX = blockSizeX * tileSizePerZoomLevel[i] / TILEWIDTH;
+                const int blockSizeResizedY = blockSizeY * tileSizePerZoomLevel[i] / TILEWIDTH;
+                fheroes2::Resize( _blockImage, 0, 0, _blockImage.width(), _blockImage.height(), _cachedImages[i], x * tileSizePerZoomLevel[i] / TILEWIDTH,
+                                  y * tileSizePerZoomLevel[i] / TILEWIDTH, blockSizeResizedX, blockSizeResizedY );
+            }
+        }
+
+        std::vector<fheroes2::Image> _cachedImages; // One image per zoom Level
+        std::vector<uint8_t> _isBlockRendered;
+        fheroes2::Image _blockImage;
+        Interface::GameArea _gameArea;
+        int _drawingFlags{ 0 };
+        int32_t _blockCountX{ 0 };
+        int32_t _blockCountY{ 0 };
     };
 
     void DrawWorld( const ViewWorld::ZoomROIs & ROI, CacheForMapWithResources & cache )
     {
         fheroes2::Display & display = fheroes2::Display::instance();
-        const fheroes2::Image & image = cache.cachedImages[static_cast<int>( ROI._zoomLevel )];
 
         const fheroes2::Rect & roiScreen = Interface::Basic::Get().GetGameArea().GetROI();
 
@@ -231,6 +271,8 @@ namespace
         const fheroes2::Point outPos( BORDERWIDTH + ( offsetPixelsX < 0 ? -offsetPixelsX : 0 ), BORDERWIDTH + ( offsetPixelsY < 0 ? -offsetPixelsY : 0 ) );
         const fheroes2::Size outSize( roiScreen.width + 2 * BORDERWIDTH + RADARWIDTH, roiScreen.height );
 
+        const fheroes2::Image & image = cache.getImage( static_cast<int>( ROI._zoomLevel ), { inPos, outSize } );
+
         fheroes2::Blit( image, inPos, display, outPos, outSize );
 
         // now, blit black pixels outside of the main view
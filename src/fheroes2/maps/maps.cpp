@@ -44,12 +44,13 @@
 
 namespace
 {
-    Maps::Indexes MapsIndexesFilteredObject( const Maps::Indexes & indexes, const MP2::MapObjectType objectType, const bool ignoreHeroes = true )
+    template <typename T>
+    T MapsIndexesFilteredObject( const T & indexes, const MP2::MapObjectType objectType, const bool ignoreHeroes = true )
     {
-        Maps::Indexes result;
-        for ( size_t idx = 0; idx < indexes.size(); ++idx ) {
-            if ( world.GetTiles( indexes[idx] ).GetObject( !ignoreHeroes ) == objectType ) {
-                result.push_back( indexes[idx] );
+        T result;
+        for ( const int32_t index : indexes ) {
+            if ( world.GetTiles( index ).GetObject( !ignoreHeroes ) == objectType ) {
+                result.push_back( index );
             }
         }
         return result;
@@ -66,42 +67,6 @@ namespace
         }
         return result;
     }
-
-    bool isTileUnderMonsterProtection( const int32_t tileIndex, const int32_t monsterTileIndex )
-    {
-        const Maps::Tiles & tile = world.GetTiles( tileIndex );
-        const Maps::Tiles & monsterTile = world.GetTiles( monsterTileIndex );
-
-        // A pickupable object can be accessed without triggering a monster attack
-        if ( MP2::isPickupObject( tile.GetObject() ) || monsterTile.GetObject() != MP2::OBJ_MONSTER || tile.isWater() != monsterTile.isWater() ) {
-            return false;
-        }
-
-        const int directionToMonster = Maps::GetDirection( tileIndex, monsterTileIndex );
-        const int directionFromMonster = Direction::Reflect( directionToMonster );
-
-        // The tile is directly accessible to the monster
-        if ( ( tile.GetPassable() & directionToMonster ) && ( monsterTile.GetPassable() & directionFromMonster ) ) {
-            return true;
-        }
-
-        // The tile is not directly accessible to the monster, but he can still attack in the diagonal direction if, when the hero moves away from the tile
-        // in question in the vertical direction and the monster moves away from his tile in the horizontal direction, they would have to meet
-        if ( directionFromMonster == Direction::TOP_LEFT && ( tile.GetPassable() & Direction::BOTTOM ) && ( monsterTile.GetPassable() & Direction::LEFT ) ) {
-            return true;
-        }
-        if ( directionFromMonster == Direction::TOP_RIGHT && ( tile.GetPassable() & Direction::BOTTOM ) && ( monsterTile.GetPassable() & Direction::RIGHT ) ) {
-            return true;
-        }
-        if ( directionFromMonster == Direction::BOTTOM_RIGHT && ( tile.GetPassable() & Direction::TOP ) && ( monsterTile.GetPassable() & Direction::RIGHT ) ) {
-            return true;
-        }
-        if ( directionFromMonster == Direction::BOTTOM_LEFT && ( tile.GetPassable() & Direction::TOP ) && ( monsterTile.GetPassable() & Direction::LEFT ) ) {
-            return true;
-        }
-
-        return false;
-    }
 }
 
 struct ComparisonDistance
@@ -295,7 +260,43 @@ int32_t Maps::GetIndexFromAbsPoint( const int32_t x, const int32_t y )
     return y * world.w() + x;
 }
 
-Maps::Indexes Maps::getAroundIndexes( const int32_t tileIndex, const int32_t maxDistanceFromTile /* = 1 */ )
+Maps::AroundIndexes Maps::getAroundIndexes( const int32_t tileIndex )
+{
+    AroundIndexes results;
+
+    if ( !isValidAbsIndex( tileIndex ) ) {
+        return results;
+    }
+
+    const int32_t worldWidth = world.w();
+    const int32_t worldHeight = world.h();
+    assert( worldWidth > 0 );
+
+    const int32_t centerX = tileIndex % worldWidth;
+    const int32_t centerY = tileIndex / worldWidth;
+
+    const int32_t minX = ( centerX > 0 ) ? -1 : 0;
+    const int32_t maxX = ( centerX < worldWidth - 1 ) ? 1 : 0;
+    const int32_t minY = ( centerY > 0 ) ? -1 : 0;
+    const int32_t maxY = ( centerY < worldHeight - 1 ) ? 1 : 0;
+
+    for ( int32_t y = minY; y <= maxY; ++y ) {
+        const int32_t rowIndex = tileIndex + y * worldWidth;
+
+        for ( int32_t x = minX; x <= maxX; ++x ) {
+            // the central tile is not included
+            if ( x == 0 && y == 0 ) {
+                continue;
+            }
+
+            results.push_back( rowIndex + x );
+        }
+    }
+
+    return results;
+}
+
+Maps::Indexes Maps::getAroundIndexes( const int32_t tileIndex, const int32_t maxDistanceFromTile )
 {
     Indexes results;
 
@@ -356,19 +357,35 @@ void Maps::ClearFog( const int32_t tileIndex, int scouteValue, const int playerC
     const int32_t maxX = std::min( center.x + scouteValue, world.w() - 1 );
     assert( minX < maxX );
 
+    const FogTileData & fogData = world.getFogTileData();
+
     for ( int32_t y = minY; y <= maxY; ++y ) {
         const int32_t dy = y - center.y;
+        if ( dy * dy > revealRadiusSquared ) {
+            continue;
+        }
 
-        for ( int32_t x = minX; x <= maxX; ++x ) {
-            const int32_t dx = x - center.x;
-            if ( revealRadiusSquared >= dx * dx + dy * dy ) {
-                Maps::Tiles & tile = world.GetTiles( x, y );
-                if ( isAIPlayer && tile.isFog( playerColor ) ) {
-                    AI::Get().revealFog( tile );
-                }
+        // The revealed area is a circle so every row of it is a continuous span of tiles.
+        int32_t halfWidth = scouteValue;
+        while ( halfWidth * halfWidth + dy * dy > revealRadiusSquared ) {
+            --halfWidth;
+        }
+
+        const int32_t spanMinX = std::max( center.x - halfWidth, minX );
+        const int32_t spanMaxX = std::min( center.x + halfWidth, maxX );
+
+        // Most of the time the area around castles and heroes is already revealed, skip such rows without visiting their tiles.
+        if ( fogData.isRowClear( y, spanMinX, spanMaxX, alliedColors ) ) {
+            continue;
+        }
 
-                tile.ClearFog( alliedColors );
+        for ( int32_t x = spanMinX; x <= spanMaxX; ++x ) {
+            Maps::Tiles & tile = world.GetTiles( x, y );
+            if ( isAIPlayer && tile.isFog( playerColor ) ) {
+                AI::Get().revealFog( tile );
             }
+
+            tile.ClearFog( alliedColors );
         }
     }
 }
@@ -416,15 +433,14 @@ int32_t Maps::getFogTileCountToBeRevealed( const int32_t tileIndex, int scouteVa
     return tileCount;
 }
 
-Maps::Indexes Maps::ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType, const bool ignoreHeroes )
+Maps::AroundIndexes Maps::ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType, const bool ignoreHeroes )
 {
-    Indexes results = getAroundIndexes( center );
-    return MapsIndexesFilteredObject( results, objectType, ignoreHeroes );
+    return MapsIndexesFilteredObject( getAroundIndexes( center ), objectType, ignoreHeroes );
 }
 
-Maps::Indexes Maps::GetFreeIndexesAroundTile( const int32_t center )
+Maps::AroundIndexes Maps::GetFreeIndexesAroundTile( const int32_t center )
 {
-    Indexes results = getAroundIndexes( center );
+    AroundIndexes results = getAroundIndexes( center );
     results.erase( std::remove_if( results.begin(), results.end(), []( const int32_t tile ) { return !world.GetTiles( tile ).isClearGround(); } ), results.end() );
     return results;
 }
@@ -435,10 +451,9 @@ bool Maps::isValidForDimensionDoor( int32_t targetIndex, bool isWater )
     return ( tile.GetPassable() & Direction::CENTER ) != 0 && isWater == tile.isWater() && !MP2::isActionObject( tile.GetObject( true ) );
 }
 
-Maps::Indexes Maps::ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType )
+Maps::AroundIndexes Maps::ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType )
 {
-    Indexes results = getAroundIndexes( center );
-    return MapsIndexesFilteredObject( results, objectType );
+    return MapsIndexesFilteredObject( getAroundIndexes( center ), objectType );
 }
 
 Maps::Indexes Maps::ScanAroundObjectWithDistance( const int32_t center, const uint32_t dist, const MP2::MapObjectType objectType )
@@ -462,51 +477,33 @@ Maps::Indexes Maps::GetObjectPositions( int32_t center, const MP2::MapObjectType
 
 bool Maps::isTileUnderProtection( const int32_t tileIndex )
 {
-    return world.GetTiles( tileIndex ).GetObject() == MP2::OBJ_MONSTER ? true : !getMonstersProtectingTile( tileIndex ).empty();
+    return getMonsterProtectionDirections( tileIndex ) != 0;
 }
 
-Maps::Indexes Maps::getMonstersProtectingTile( const int32_t tileIndex )
+uint16_t Maps::getMonsterProtectionDirections( const int32_t tileIndex )
 {
-    Indexes result;
-    if ( !isValidAbsIndex( tileIndex ) )
-        return result;
-
-    result.reserve( 9 );
-    const int width = world.w();
-    const int x = tileIndex % width;
-    const int y = tileIndex / width;
-
-    auto validateAndInsert = [&result, tileIndex]( const int monsterTileIndex ) {
-        if ( isTileUnderMonsterProtection( tileIndex, monsterTileIndex ) ) {
-            result.push_back( monsterTileIndex );
-        }
-    };
-
-    if ( y > 0 ) {
-        if ( x > 0 )
-            validateAndInsert( tileIndex - width - 1 );
-
-        validateAndInsert( tileIndex - width );
-
-        if ( x < width - 1 )
-            validateAndInsert( tileIndex - width + 1 );
+    if ( !isValidAbsIndex( tileIndex ) ) {
+        return 0;
     }
 
-    if ( x > 0 )
-        validateAndInsert( tileIndex - 1 );
-    if ( MP2::OBJ_MONSTER == world.GetTiles( tileIndex ).GetObject() )
-        result.push_back( tileIndex );
-    if ( x < width - 1 )
-        validateAndInsert( tileIndex + 1 );
+    return world.getPathfindingTileData().getMonsterProtection( tileIndex );
+}
 
-    if ( y < world.h() - 1 ) {
-        if ( x > 0 )
-            validateAndInsert( tileIndex + width - 1 );
+Maps::Indexes Maps::getMonstersProtectingTile( const int32_t tileIndex )
+{
+    Indexes result;
 
-        validateAndInsert( tileIndex + width );
+    const uint16_t protectionDirections = getMonsterProtectionDirections( tileIndex );
+    if ( protectionDirections == 0 ) {
+        return result;
+    }
 
-        if ( x < width - 1 )
-            validateAndInsert( tileIndex + width + 1 );
+    // Keep the order of tiles from top to bottom and from left to right.
+    for ( const int direction : { Direction::TOP_LEFT, Direction::TOP, Direction::TOP_RIGHT, Direction::LEFT, Direction::CENTER, Direction::RIGHT, Direction::BOTTOM_LEFT,
+                                  Direction::BOTTOM, Direction::BOTTOM_RIGHT } ) {
+        if ( protectionDirections & direction ) {
+            result.push_back( direction == Direction::CENTER ? tileIndex : GetDirectionIndex( tileIndex, direction ) );
+        }
     }
 
     return result;
@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "fixed_vector.h"
 #include "math_base.h"
 #include "mp2.h"
 
@@ -47,6 +48,9 @@ namespace Maps
 
     using Indexes = MapsIndexes;
 
+    // A tile has at most 8 neighbours so lists of adjacent tiles are kept in a container which does not allocate memory.
+    using AroundIndexes = fheroes2::FixedVector<int32_t, 8>;
+
     const char * SizeString( int size );
     const char * GetMinesName( int res );
 
@@ -63,16 +67,22 @@ namespace Maps
     int32_t GetIndexFromAbsPoint( const fheroes2::Point & mp );
     int32_t GetIndexFromAbsPoint( const int32_t x, const int32_t y );
 
-    Indexes getAroundIndexes( const int32_t tileIndex, const int32_t maxDistanceFromTile = 1 );
+    // Returns indexes of valid tiles adjacent to the given tile, sorted from top-left to bottom-right. The given tile itself is not included.
+    AroundIndexes getAroundIndexes( const int32_t tileIndex );
+    // Returns indexes of valid tiles within the given distance from the given tile. The given tile itself is not included.
+    Indexes getAroundIndexes( const int32_t tileIndex, const int32_t maxDistanceFromTile );
 
-    Indexes ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType );
+    AroundIndexes ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType );
     Indexes ScanAroundObjectWithDistance( const int32_t center, const uint32_t dist, const MP2::MapObjectType objectType );
-    Indexes ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType, const bool ignoreHeroes );
-    Indexes GetFreeIndexesAroundTile( const int32_t center );
+    AroundIndexes ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType, const bool ignoreHeroes );
+    AroundIndexes GetFreeIndexesAroundTile( const int32_t center );
 
     bool isValidForDimensionDoor( int32_t targetIndex, bool isWater );
     // Checks if the tile is guarded by a monster
     bool isTileUnderProtection( const int32_t tileIndex );
+    // Returns a bitmask of directions (see Direction namespace) to adjacent tiles with monsters guarding the given tile.
+    // Direction::CENTER is set if the tile itself contains a monster. Unlike getMonstersProtectingTile() it does not allocate memory.
+    uint16_t getMonsterProtectionDirections( const int32_t tileIndex );
     // Returns a list of indexes of tiles with monsters guarding the given tile
     Indexes getMonstersProtectingTile( const int32_t tileIndex );
 
@@ -800,6 +800,8 @@ MP2::MapObjectType Maps::Tiles::GetObject( bool ignoreObjectUnderHero /* true */
 void Maps::Tiles::SetObject( const MP2::MapObjectType objectType )
 {
     mp2_object = objectType;
+    world.updatePathfindingTileData( *this );
+    world.addRadarUpdateArea( { GetCenter().x, GetCenter().y, 1, 1 } );
     world.resetPathfinder();
 }
 
@@ -1680,6 +1682,8 @@ void Maps::Tiles::SetObjectPassable( bool pass )
             tilePassable |= Direction::TOP_LEFT;
         else
             tilePassable &= ~Direction::TOP_LEFT;
+
+        world.updatePathfindingTileData( *this );
         break;
 
     default:
@@ -2097,6 +2101,9 @@ void Maps::Tiles::RemoveObjectSprite()
         Remove( uniq );
         break;
     }
+
+    // Passability of jails and barriers has been changed.
+    world.updatePathfindingTileData( *this );
 }
 
 void Maps::Tiles::RemoveJailSprite()
@@ -2286,6 +2293,19 @@ std::pair<uint32_t, uint32_t> Maps::Tiles::GetMonsterSpriteIndices( const Tiles
     return spriteIndices;
 }
 
+void Maps::Tiles::ClearFog( int colors )
+{
+    if ( ( fog_colors & colors ) == 0 ) {
+        // The fog is already cleared for these colors.
+        return;
+    }
+
+    fog_colors &= ~colors;
+    world.updatePathfindingTileData( *this );
+    world.updateFogTileData( *this );
+    world.addRadarUpdateArea( { GetCenter().x, GetCenter().y, 1, 1 } );
+}
+
 bool Maps::Tiles::isFogAllAround( const int color ) const
 {
     const int32_t center = GetIndex();
@@ -2320,17 +2340,7 @@ bool Maps::Tiles::isFogAllAround( const int color ) const
 
 int Maps::Tiles::GetFogDirections( int color ) const
 {
-    int around = 0;
-    const Directions & directions = Direction::All();
-
-    for ( Directions::const_iterator it = directions.begin(); it != directions.end(); ++it )
-        if ( !Maps::isValidDirection( _index, *it ) || world.GetTiles( Maps::GetDirectionIndex( _index, *it ) ).isFog( color ) )
-            around |= *it;
-
-    if ( isFog( color ) )
-        around |= Direction::CENTER;
-
-    return around;
+    return world.getFogTileData().getFogDirections( _index, color );
 }
 
 void Maps::Tiles::drawFog( fheroes2::Image & dst, int color, const Interface::GameArea & area ) const
@@ -2572,7 +2582,7 @@ void Maps::Tiles::setAsEmpty()
 
     bool isCoast = false;
 
-    const Indexes tileIndices = Maps::getAroundIndexes( _index, 1 );
+    const AroundIndexes tileIndices = Maps::getAroundIndexes( _index );
     for ( const int tileIndex : tileIndices ) {
         if ( tileIndex < 0 ) {
             // Invalid tile index.
@@ -292,13 +292,15 @@ namespace Maps
             return ( fog_colors & colors ) == colors;
         }
 
-        bool isFogAllAround( const int color ) const;
-
-        void ClearFog( int colors )
+        uint8_t getFogColors() const
         {
-            fog_colors &= ~colors;
+            return fog_colors;
         }
 
+        bool isFogAllAround( const int color ) const;
+
+        void ClearFog( int colors );
+
         /* monster operation */
         void MonsterSetCount( uint32_t count );
         uint32_t MonsterCount() const;
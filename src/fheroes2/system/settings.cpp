@@ -69,8 +69,8 @@ namespace
         GLOBAL_3D_AUDIO = 0x00010000,
         GLOBAL_SYSTEM_INFO = 0x00020000,
         GLOBAL_CURSOR_SOFT_EMULATION = 0x00040000,
-        // UNUSED = 0x00080000,
-        // UNUSED = 0x00100000,
+        GLOBAL_RESOURCE_PRELOADING = 0x00080000,
+        GLOBAL_SPRITE_DISK_CACHE = 0x00100000,
         GLOBAL_BATTLE_SHOW_DAMAGE = 0x00200000,
         GLOBAL_BATTLE_SHOW_ARMY_ORDER = 0x00400000,
         GLOBAL_BATTLE_SHOW_GRID = 0x00800000,
@@ -102,6 +102,7 @@ Settings::Settings()
 {
     _optGlobal.SetModes( GLOBAL_FIRST_RUN );
     _optGlobal.SetModes( GLOBAL_SHOW_INTRO );
+    _optGlobal.SetModes( GLOBAL_RESOURCE_PRELOADING );
 
     _optGlobal.SetModes( GLOBAL_SHOWRADAR );
     _optGlobal.SetModes( GLOBAL_SHOWICONS );
@@ -310,6 +311,14 @@ bool Settings::Read( const std::string & filename )
         }
     }
 
+    if ( config.Exists( "resource preloading" ) ) {
+        setResourcePreloading( config.StrParams( "resource preloading" ) == "on" );
+    }
+
+    if ( config.Exists( "sprite disk cache" ) ) {
+        setSpriteDiskCache( config.StrParams( "sprite disk cache" ) == "on" );
+    }
+
     BinaryLoad();
 
     return true;
@@ -435,6 +444,12 @@ std::string Settings::String() const
     os << std::endl << "# enable cursor software rendering" << std::endl;
     os << "cursor soft rendering = " << ( _optGlobal.Modes( GLOBAL_CURSOR_SOFT_EMULATION ) ? "on" : "off" ) << std::endl;
 
+    os << std::endl << "# decode frequently used images in background while Main Menu is shown: on/off" << std::endl;
+    os << "resource preloading = " << ( _optGlobal.Modes( GLOBAL_RESOURCE_PRELOADING ) ? "on" : "off" ) << std::endl;
+
+    os << std::endl << "# store generated images on disk to speed up next game launches: on/off" << std::endl;
+    os << "sprite disk cache = " << ( _optGlobal.Modes( GLOBAL_SPRITE_DISK_CACHE ) ? "on" : "off" ) << std::endl;
+
     return os.str();
 }
 
@@ -701,6 +716,26 @@ void Settings::setSystemInfo( const bool enable )
     }
 }
 
+void Settings::setResourcePreloading( const bool enable )
+{
+    if ( enable ) {
+        _optGlobal.SetModes( GLOBAL_RESOURCE_PRELOADING );
+    }
+    else {
+        _optGlobal.ResetModes( GLOBAL_RESOURCE_PRELOADING );
+    }
+}
+
+void Settings::setSpriteDiskCache( const bool enable )
+{
+    if ( enable ) {
+        _optGlobal.SetModes( GLOBAL_SPRITE_DISK_CACHE );
+    }
+    else {
+        _optGlobal.ResetModes( GLOBAL_SPRITE_DISK_CACHE );
+    }
+}
+
 void Settings::setBattleDamageInfo( const bool enable )
 {
     if ( enable ) {
@@ -741,6 +776,16 @@ bool Settings::isSystemInfoEnabled() const
     return _optGlobal.Modes( GLOBAL_SYSTEM_INFO );
 }
 
+bool Settings::isResourcePreloadingEnabled() const
+{
+    return _optGlobal.Modes( GLOBAL_RESOURCE_PRELOADING );
+}
+
+bool Settings::isSpriteDiskCacheEnabled() const
+{
+    return _optGlobal.Modes( GLOBAL_SPRITE_DISK_CACHE );
+}
+
 bool Settings::isBattleShowDamageInfoEnabled() const
 {
     return _optGlobal.Modes( GLOBAL_BATTLE_SHOW_DAMAGE );
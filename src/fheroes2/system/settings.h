@@ -235,6 +235,8 @@ public:
     bool is3DAudioEnabled() const;
     bool isSystemInfoEnabled() const;
     bool isBattleShowDamageInfoEnabled() const;
+    bool isResourcePreloadingEnabled() const;
+    bool isSpriteDiskCacheEnabled() const;
 
     bool LoadedGameVersion() const
     {
@@ -323,6 +325,8 @@ public:
     void setVSync( const bool enable );
     void setSystemInfo( const bool enable );
     void setBattleDamageInfo( const bool enable );
+    void setResourcePreloading( const bool enable );
+    void setSpriteDiskCache( const bool enable );
 
     void SetSoundVolume( int v );
     void SetMusicVolume( int v );
@@ -32,6 +32,8 @@
 #include <utility>
 
 #include "ai.h"
+#include "army.h"
+#include "army_troop.h"
 #include "artifact.h"
 #include "campaign_savedata.h"
 #include "campaign_scenariodata.h"
@@ -90,7 +92,7 @@ namespace
     {
         std::vector<int32_t> suitableIds;
 
-        const MapsIndexes & indexes = Maps::getAroundIndexes( tileId );
+        const Maps::AroundIndexes indexes = Maps::getAroundIndexes( tileId );
 
         for ( const int32_t indexId : indexes ) {
             // If allDirections is false, we should only consider tiles below the current object
@@ -106,7 +108,7 @@ namespace
 
             // If the candidate tile is a coast tile, it is suitable only if there are other coast tiles nearby
             if ( indexedTile.GetObject( false ) == MP2::OBJ_COAST ) {
-                const MapsIndexes coastTiles = Maps::ScanAroundObject( indexId, MP2::OBJ_COAST );
+                const Maps::AroundIndexes coastTiles = Maps::ScanAroundObject( indexId, MP2::OBJ_COAST );
 
                 if ( coastTiles.empty() ) {
                     continue;
@@ -127,7 +129,7 @@ namespace
     {
         int32_t count = 0;
 
-        const MapsIndexes & indexes = Maps::getAroundIndexes( tileId );
+        const Maps::AroundIndexes indexes = Maps::getAroundIndexes( tileId );
 
         for ( const int32_t indexId : indexes ) {
             const Maps::Tiles & indexedTile = mapTiles[indexId];
@@ -140,6 +142,14 @@ namespace
 
         return count;
     }
+
+    // Captured objects (castles, mines, lighthouses etc) are shown on the radar in the color of their owner on all their tiles.
+    // None of these objects spans more than 3 tiles to the left, to the right and above its main tile or more than 1 tile below it.
+    fheroes2::Rect getCapturedObjectArea( const int32_t mainTileIndex )
+    {
+        const fheroes2::Point mainTilePos = Maps::GetPoint( mainTileIndex );
+        return { mainTilePos.x - 3, mainTilePos.y - 3, 7, 5 };
+    }
 }
 
 namespace GameStatic
@@ -312,6 +322,7 @@ void CapturedObjects::ResetColor( int color )
 
             objcol.second = objectType == MP2::OBJ_CASTLE ? Color::UNUSED : Color::NONE;
             world.GetTiles( it->first ).setOwnershipFlag( objectType, objcol.second );
+            world.addRadarUpdateArea( getCapturedObjectArea( it->first ) );
         }
     }
 }
@@ -347,6 +358,10 @@ void World::Reset()
 
     // maps tiles
     vec_tiles.clear();
+    _pathfindingTileData.clear();
+    _fogTileData.clear();
+    _monsterStrengthCache.clear();
+    _radarUpdateArea = {};
 
     // kingdoms
     vec_kingdoms.clear();
@@ -424,6 +439,10 @@ void World::NewMaps( int32_t sw, int32_t sh )
 
         vec_tiles[i].Init( static_cast<int32_t>( i ), mp2tile );
     }
+
+    _pathfindingTileData.reset( vec_tiles, width );
+    _fogTileData.reset( vec_tiles, width );
+    _monsterStrengthCache.assign( vec_tiles.size(), {} );
 }
 
 const Castle * World::getCastleEntrance( const fheroes2::Point & tilePosition ) const
@@ -559,9 +578,25 @@ void World::NewWeek()
 {
     // update objects
     if ( week > 1 ) {
-        for ( Maps::Tiles & tile : vec_tiles ) {
-            if ( MP2::isWeekLife( tile.GetObject( false ) ) || tile.GetObject() == MP2::OBJ_MONSTER ) {
-                tile.QuantityUpdate( false );
+        // Object types of all tiles are kept in a compact array so most of the tiles are skipped without visiting them.
+        // The tiles have to be updated in the same order as before because the update uses the random number generator.
+        const int32_t tileCount = static_cast<int32_t>( vec_tiles.size() );
+
+        for ( int32_t index = 0; index < tileCount; ++index ) {
+            const MP2::MapObjectType objectType = _pathfindingTileData.getObject( index );
+
+            if ( objectType == MP2::OBJ_HEROES ) {
+                // A hero can stand on an object which has to be updated.
+                Maps::Tiles & tile = vec_tiles[index];
+                if ( MP2::isWeekLife( tile.GetObject( false ) ) ) {
+                    tile.QuantityUpdate( false );
+                }
+
+                continue;
+            }
+
+            if ( MP2::isWeekLife( objectType ) || objectType == MP2::OBJ_MONSTER ) {
+                vec_tiles[index].QuantityUpdate( false );
             }
         }
     }
@@ -885,6 +920,8 @@ void World::CaptureObject( int32_t index, int color )
 
     if ( color & ( Color::ALL | Color::UNUSED ) )
         GetTiles( index ).setOwnershipFlag( objectType, color );
+
+    addRadarUpdateArea( getCapturedObjectArea( index ) );
 }
 
 /* return color captured object */
@@ -1244,6 +1281,50 @@ void World::resetPathfinder()
     AI::Get().resetPathfinder();
 }
 
+void World::addRadarUpdateArea( const fheroes2::Rect & roi )
+{
+    if ( roi.width <= 0 || roi.height <= 0 ) {
+        return;
+    }
+
+    if ( _radarUpdateArea.width <= 0 || _radarUpdateArea.height <= 0 ) {
+        _radarUpdateArea = roi;
+        return;
+    }
+
+    _radarUpdateArea = fheroes2::getBoundaryRect( _radarUpdateArea, roi );
+}
+
+fheroes2::Rect World::takeRadarUpdateArea()
+{
+    const fheroes2::Rect roi = _radarUpdateArea;
+    _radarUpdateArea = {};
+
+    return roi;
+}
+
+double World::getTileArmyStrength( const Maps::Tiles & tile )
+{
+    if ( tile.GetObject( false ) != MP2::OBJ_MONSTER ) {
+        return Army( tile ).GetStrength();
+    }
+
+    const size_t tileIndex = static_cast<size_t>( tile.GetIndex() );
+    assert( tileIndex < _monsterStrengthCache.size() );
+
+    // The arrangement of monsters depends only on the tile index, the map seed and the monsters themselves.
+    const Troop troop = tile.QuantityTroop();
+
+    MonsterStrengthCacheEntry & entry = _monsterStrengthCache[tileIndex];
+    if ( entry.monsterId != troop.GetID() || entry.monsterCount != troop.GetCount() ) {
+        entry.monsterId = troop.GetID();
+        entry.monsterCount = troop.GetCount();
+        entry.strength = Army( tile ).GetStrength();
+    }
+
+    return entry.strength;
+}
+
 void World::PostLoad( const bool setTilePassabilities )
 {
     if ( setTilePassabilities ) {
@@ -1273,6 +1354,10 @@ void World::PostLoad( const bool setTilePassabilities )
         _allWhirlpools[GetTiles( index ).GetObjectSpriteIndex()].push_back( index );
     }
 
+    _pathfindingTileData.reset( vec_tiles, width );
+    _fogTileData.reset( vec_tiles, width );
+    _monsterStrengthCache.assign( vec_tiles.size(), {} );
+
     resetPathfinder();
     ComputeStaticAnalysis();
 }
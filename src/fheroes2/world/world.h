@@ -43,6 +43,7 @@
 #include "mp2.h"
 #include "pairs.h"
 #include "resource.h"
+#include "world_fog.h"
 #include "world_pathfinding.h"
 #include "world_regions.h"
 
@@ -365,6 +366,37 @@ public:
     std::list<Route::Step> getPath( const Heroes & hero, int targetIndex );
     void resetPathfinder();
 
+    const PathfindingTileData & getPathfindingTileData() const
+    {
+        return _pathfindingTileData;
+    }
+
+    // Must be called every time the object type, passability, terrain or fog of a tile is changed after the map is loaded.
+    void updatePathfindingTileData( const Maps::Tiles & tile )
+    {
+        _pathfindingTileData.update( tile );
+    }
+
+    const FogTileData & getFogTileData() const
+    {
+        return _fogTileData;
+    }
+
+    // Must be called every time the fog of a tile is changed after the map is loaded.
+    void updateFogTileData( const Maps::Tiles & tile )
+    {
+        _fogTileData.update( tile );
+    }
+
+    // Extends the area of the map (in tiles) which has to be updated on the radar by the given area.
+    void addRadarUpdateArea( const fheroes2::Rect & roi );
+    // Returns the area of the map (in tiles) changed since the previous call. An empty area means that nothing has changed.
+    fheroes2::Rect takeRadarUpdateArea();
+
+    // Returns the strength of the army guarding the given tile, the same as Army( tile ).GetStrength() does. The strength of
+    // wandering monsters is cached per tile and it is re-calculated only when the type or the number of monsters on the tile changes.
+    double getTileArmyStrength( const Maps::Tiles & tile );
+
     void ComputeStaticAnalysis();
     static uint32_t GetUniq();
 
@@ -418,6 +450,18 @@ private:
     std::map<uint8_t, Maps::Indexes> _allWhirlpools; // All indexes of tiles that contain a certain part (sprite index) of the whirlpool
 
     std::vector<MapRegion> _regions;
+    PathfindingTileData _pathfindingTileData;
+    FogTileData _fogTileData;
+    fheroes2::Rect _radarUpdateArea;
+
+    struct MonsterStrengthCacheEntry
+    {
+        int monsterId{ Monster::UNKNOWN };
+        uint32_t monsterCount{ 0 };
+        double strength{ 0 };
+    };
+
+    std::vector<MonsterStrengthCacheEntry> _monsterStrengthCache;
     PlayerWorldPathfinder _pathfinder;
 };
 
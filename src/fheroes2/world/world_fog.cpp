@@ -0,0 +1,180 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2022                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+
+#include "color.h"
+#include "direction.h"
+#include "maps_tiles.h"
+#include "world_fog.h"
+
+void FogTileData::reset( const std::vector<Maps::Tiles> & tiles, const int32_t mapWidth )
+{
+    const int32_t tileCount = static_cast<int32_t>( tiles.size() );
+
+    _mapWidth = mapWidth;
+    _mapHeight = mapWidth > 0 ? tileCount / mapWidth : 0;
+    _wordsPerRow = ( _mapWidth + bitsPerWord - 1 ) / bitsPerWord;
+
+    for ( int32_t colorIndex = 0; colorIndex < colorCount; ++colorIndex ) {
+        _fogPlanes[colorIndex].assign( static_cast<size_t>( _wordsPerRow ) * _mapHeight, 0 );
+        _fogDirections[colorIndex].resize( tiles.size() );
+    }
+
+    for ( const Maps::Tiles & tile : tiles ) {
+        setTileFog( tile );
+    }
+
+    // Directions depend on the fog of neighbouring tiles so they are calculated once the fog of all tiles is set.
+    for ( int32_t colorIndex = 0; colorIndex < colorCount; ++colorIndex ) {
+        for ( int32_t index = 0; index < tileCount; ++index ) {
+            _fogDirections[colorIndex][index] = calculateFogDirections( colorIndex, index );
+        }
+    }
+}
+
+void FogTileData::clear()
+{
+    for ( int32_t colorIndex = 0; colorIndex < colorCount; ++colorIndex ) {
+        _fogPlanes[colorIndex].clear();
+        _fogDirections[colorIndex].clear();
+    }
+
+    _mapWidth = 0;
+    _mapHeight = 0;
+    _wordsPerRow = 0;
+}
+
+void FogTileData::update( const Maps::Tiles & tile )
+{
+    const int32_t index = tile.GetIndex();
+
+    // Fog is being set while the map is loading. All data is set once the loading is complete.
+    if ( index < 0 || static_cast<size_t>( index ) >= _fogDirections[0].size() ) {
+        return;
+    }
+
+    setTileFog( tile );
+
+    // Changes of the fog affect directions of the tile itself and of all tiles around it.
+    const int32_t x = index % _mapWidth;
+    const int32_t y = index / _mapWidth;
+
+    for ( int32_t colorIndex = 0; colorIndex < colorCount; ++colorIndex ) {
+        for ( int32_t neighbourY = std::max( y - 1, 0 ); neighbourY <= std::min( y + 1, _mapHeight - 1 ); ++neighbourY ) {
+            for ( int32_t neighbourX = std::max( x - 1, 0 ); neighbourX <= std::min( x + 1, _mapWidth - 1 ); ++neighbourX ) {
+                const int32_t neighbourIndex = neighbourY * _mapWidth + neighbourX;
+                _fogDirections[colorIndex][neighbourIndex] = calculateFogDirections( colorIndex, neighbourIndex );
+            }
+        }
+    }
+}
+
+bool FogTileData::isRowClear( const int32_t y, const int32_t minX, const int32_t maxX, const int colors ) const
+{
+    assert( y >= 0 && y < _mapHeight && minX >= 0 && minX <= maxX && maxX < _mapWidth );
+
+    const int32_t firstWord = y * _wordsPerRow + minX / bitsPerWord;
+    const int32_t lastWord = y * _wordsPerRow + maxX / bitsPerWord;
+
+    const uint64_t firstWordMask = ~0ULL << ( minX % bitsPerWord );
+    const uint64_t lastWordMask = ~0ULL >> ( bitsPerWord - 1 - maxX % bitsPerWord );
+
+    for ( int32_t colorIndex = 0; colorIndex < colorCount; ++colorIndex ) {
+        if ( ( colors & ( 1 << colorIndex ) ) == 0 ) {
+            continue;
+        }
+
+        const std::vector<uint64_t> & plane = _fogPlanes[colorIndex];
+
+        if ( firstWord == lastWord ) {
+            if ( plane[firstWord] & firstWordMask & lastWordMask ) {
+                return false;
+            }
+
+            continue;
+        }
+
+        if ( ( plane[firstWord] & firstWordMask ) || ( plane[lastWord] & lastWordMask ) ) {
+            return false;
+        }
+
+        for ( int32_t word = firstWord + 1; word < lastWord; ++word ) {
+            if ( plane[word] ) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+uint16_t FogTileData::getFogDirections( const int32_t index, const int colors ) const
+{
+    // A tile is considered to be covered by fog for a union of colors only if it is covered by fog for every color of the union.
+    uint16_t directions = DIRECTION_ALL;
+
+    for ( int32_t colorIndex = 0; colorIndex < colorCount; ++colorIndex ) {
+        if ( colors & ( 1 << colorIndex ) ) {
+            directions &= _fogDirections[colorIndex][index];
+        }
+    }
+
+    return directions;
+}
+
+void FogTileData::setTileFog( const Maps::Tiles & tile )
+{
+    const int32_t index = tile.GetIndex();
+    const int32_t word = ( index / _mapWidth ) * _wordsPerRow + ( index % _mapWidth ) / bitsPerWord;
+    const uint64_t bit = 1ULL << ( ( index % _mapWidth ) % bitsPerWord );
+
+    const uint8_t fogColors = tile.getFogColors();
+
+    for ( int32_t colorIndex = 0; colorIndex < colorCount; ++colorIndex ) {
+        if ( fogColors & ( 1 << colorIndex ) ) {
+            _fogPlanes[colorIndex][word] |= bit;
+        }
+        else {
+            _fogPlanes[colorIndex][word] &= ~bit;
+        }
+    }
+}
+
+uint16_t FogTileData::calculateFogDirections( const int32_t colorIndex, const int32_t index ) const
+{
+    const int32_t x = index % _mapWidth;
+    const int32_t y = index / _mapWidth;
+
+    uint16_t directions = isFog( colorIndex, x, y ) ? Direction::CENTER : 0;
+
+    for ( const int direction : Direction::All() ) {
+        const int32_t neighbourX = x + ( ( direction & DIRECTION_LEFT_COL ) ? -1 : ( ( direction & DIRECTION_RIGHT_COL ) ? 1 : 0 ) );
+        const int32_t neighbourY = y + ( ( direction & DIRECTION_TOP_ROW ) ? -1 : ( ( direction & DIRECTION_BOTTOM_ROW ) ? 1 : 0 ) );
+
+        // Tiles outside of the map are always considered to be covered by fog.
+        if ( neighbourX < 0 || neighbourX >= _mapWidth || neighbourY < 0 || neighbourY >= _mapHeight || isFog( colorIndex, neighbourX, neighbourY ) ) {
+            directions |= direction;
+        }
+    }
+
+    return directions;
+}
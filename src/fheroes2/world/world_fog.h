@@ -0,0 +1,75 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2022                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Maps
+{
+    class Tiles;
+}
+
+// Fog of war state of all tiles split by player colors. Every color has its own bitplane with one bit per tile (the bit is set if the tile
+// is covered by fog) and its own array of fog directions, so the fog can be checked for whole rows of tiles and drawn without visiting
+// neighbouring Maps::Tiles objects. World updates this data every time the fog of a tile is changed.
+class FogTileData
+{
+public:
+    FogTileData() = default;
+    FogTileData( const FogTileData & ) = delete;
+
+    FogTileData & operator=( const FogTileData & ) = delete;
+
+    void reset( const std::vector<Maps::Tiles> & tiles, const int32_t mapWidth );
+
+    void clear();
+
+    void update( const Maps::Tiles & tile );
+
+    // Returns true if none of the tiles of the given row from minX to maxX (inclusive) is covered by fog for any of the given colors.
+    bool isRowClear( const int32_t y, const int32_t minX, const int32_t maxX, const int colors ) const;
+
+    // Returns the same bitmask of directions as Maps::Tiles::GetFogDirections() does.
+    uint16_t getFogDirections( const int32_t index, const int colors ) const;
+
+private:
+    static constexpr int32_t colorCount = 6;
+    static constexpr int32_t bitsPerWord = 64;
+
+    bool isFog( const int32_t colorIndex, const int32_t x, const int32_t y ) const
+    {
+        return ( ( _fogPlanes[colorIndex][y * _wordsPerRow + x / bitsPerWord] >> ( x % bitsPerWord ) ) & 1 ) != 0;
+    }
+
+    void setTileFog( const Maps::Tiles & tile );
+
+    uint16_t calculateFogDirections( const int32_t colorIndex, const int32_t index ) const;
+
+    // Every row of the map starts with a new word so a span of tiles of a row can be checked word by word.
+    std::array<std::vector<uint64_t>, colorCount> _fogPlanes;
+    std::array<std::vector<uint16_t>, colorCount> _fogDirections;
+
+    int32_t _mapWidth{ 0 };
+    int32_t _mapHeight{ 0 };
+    int32_t _wordsPerRow{ 0 };
+};
@@ -67,9 +67,9 @@ namespace
 
     bool isTileBlocked( int tileIndex, bool fromWater )
     {
-        const Maps::Tiles & tile = world.GetTiles( tileIndex );
-        const bool toWater = tile.isWater();
-        const MP2::MapObjectType objectType = tile.GetObject();
+        const PathfindingTileData & tileData = world.getPathfindingTileData();
+        const bool toWater = tileData.isWater( tileIndex );
+        const MP2::MapObjectType objectType = tileData.getObject( tileIndex );
 
         if ( objectType == MP2::OBJ_HEROES || objectType == MP2::OBJ_MONSTER || objectType == MP2::OBJ_BOAT )
             return true;
@@ -85,12 +85,11 @@ namespace
 
     bool isTileBlockedForAIWithArmy( const int tileIndex, const int color, const double armyStrength, const bool isArtifactBagFull )
     {
-        const Maps::Tiles & tile = world.GetTiles( tileIndex );
-        const MP2::MapObjectType objectType = tile.GetObject();
+        const MP2::MapObjectType objectType = world.getPathfindingTileData().getObject( tileIndex );
 
         // Special cases: check if we can defeat the Hero/Monster and pass through
         if ( objectType == MP2::OBJ_HEROES ) {
-            const Heroes * otherHero = tile.GetHeroes();
+            const Heroes * otherHero = world.GetTiles( tileIndex ).GetHeroes();
             assert( otherHero != nullptr );
 
             if ( otherHero->isFriends( color ) ) {
@@ -106,7 +105,7 @@ namespace
         }
 
         if ( MP2::isArtifactObject( objectType ) ) {
-            const Artifact art = tile.QuantityArtifact();
+            const Artifact art = world.GetTiles( tileIndex ).QuantityArtifact();
             if ( art.isValid() ) {
                 if ( isFindArtifactVictoryConditionForHuman( art ) ) {
                     // WINS_ARTIFACT victory condition does not apply to AI-controlled players, we should leave this artifact untouched for the human player.
@@ -121,11 +120,14 @@ namespace
         }
 
         // Monster or artifact guarded by a monster
-        if ( objectType == MP2::OBJ_MONSTER || ( objectType == MP2::OBJ_ARTIFACT && tile.QuantityVariant() > 5 ) )
-            return Army( tile ).GetStrength() > armyStrength;
+        if ( objectType == MP2::OBJ_MONSTER || objectType == MP2::OBJ_ARTIFACT ) {
+            const Maps::Tiles & tile = world.GetTiles( tileIndex );
+            if ( objectType == MP2::OBJ_MONSTER || tile.QuantityVariant() > 5 )
+                return world.getTileArmyStrength( tile ) > armyStrength;
+        }
 
         // Check if AI has the key for the barrier
-        if ( objectType == MP2::OBJ_BARRIER && world.GetKingdom( color ).IsVisitTravelersTent( tile.QuantityColor() ) )
+        if ( objectType == MP2::OBJ_BARRIER && world.GetKingdom( color ).IsVisitTravelersTent( world.GetTiles( tileIndex ).QuantityColor() ) )
             return false;
 
         // AI can use boats to overcome water obstacles
@@ -138,8 +140,8 @@ namespace
 
     bool isValidPath( const int index, const int direction, const int heroColor )
     {
-        const Maps::Tiles & fromTile = world.GetTiles( index );
-        const bool fromWater = fromTile.isWater();
+        const PathfindingTileData & tileData = world.getPathfindingTileData();
+        const bool fromWater = tileData.isWater( index );
 
         // check corner water/coast
         if ( fromWater ) {
@@ -147,7 +149,7 @@ namespace
             switch ( direction ) {
             case Direction::TOP_LEFT: {
                 assert( index >= mapWidth + 1 );
-                if ( world.GetTiles( index - mapWidth - 1 ).isWater() && ( !world.GetTiles( index - 1 ).isWater() || !world.GetTiles( index - mapWidth ).isWater() ) ) {
+                if ( tileData.isWater( index - mapWidth - 1 ) && ( !tileData.isWater( index - 1 ) || !tileData.isWater( index - mapWidth ) ) ) {
                     // Cannot sail through the corner of land.
                     return false;
                 }
@@ -156,7 +158,7 @@ namespace
             }
             case Direction::TOP_RIGHT: {
                 assert( index >= mapWidth && index + 1 < mapWidth * world.h() );
-                if ( world.GetTiles( index - mapWidth + 1 ).isWater() && ( !world.GetTiles( index + 1 ).isWater() || !world.GetTiles( index - mapWidth ).isWater() ) ) {
+                if ( tileData.isWater( index - mapWidth + 1 ) && ( !tileData.isWater( index + 1 ) || !tileData.isWater( index - mapWidth ) ) ) {
                     // Cannot sail through the corner of land.
                     return false;
                 }
@@ -165,7 +167,7 @@ namespace
             }
             case Direction::BOTTOM_RIGHT: {
                 assert( index + mapWidth + 1 < mapWidth * world.h() );
-                if ( world.GetTiles( index + mapWidth + 1 ).isWater() && ( !world.GetTiles( index + 1 ).isWater() || !world.GetTiles( index + mapWidth ).isWater() ) ) {
+                if ( tileData.isWater( index + mapWidth + 1 ) && ( !tileData.isWater( index + 1 ) || !tileData.isWater( index + mapWidth ) ) ) {
                     // Cannot sail through the corner of land.
                     return false;
                 }
@@ -174,7 +176,7 @@ namespace
             }
             case Direction::BOTTOM_LEFT: {
                 assert( index >= 1 && index + mapWidth - 1 < mapWidth * world.h() );
-                if ( world.GetTiles( index + mapWidth - 1 ).isWater() && ( !world.GetTiles( index - 1 ).isWater() || !world.GetTiles( index + mapWidth ).isWater() ) ) {
+                if ( tileData.isWater( index + mapWidth - 1 ) && ( !tileData.isWater( index - 1 ) || !tileData.isWater( index + mapWidth ) ) ) {
                     // Cannot sail through the corner of land.
                     return false;
                 }
@@ -186,23 +188,20 @@ namespace
             }
         }
 
-        if ( !fromTile.isPassableTo( direction ) ) {
+        if ( ( direction & tileData.getPassable( index ) ) == 0 ) {
             return false;
         }
 
-        const Maps::Tiles & toTile = world.GetTiles( Maps::GetDirectionIndex( index, direction ) );
-        return toTile.isPassableFrom( Direction::Reflect( direction ), fromWater, false, heroColor );
+        return tileData.isPassableFrom( Maps::GetDirectionIndex( index, direction ), Direction::Reflect( direction ), fromWater, heroColor );
     }
 
     bool isTileProtectedForAI( const int index, const double armyStrength, const double advantage )
     {
-        const Maps::Tiles & tile = world.GetTiles( index );
-
-        if ( MP2::isProtectedObject( tile.GetObject() ) ) {
+        if ( MP2::isProtectedObject( world.getPathfindingTileData().getObject( index ) ) ) {
             // creating an Army instance is a relatively heavy operation, so cache it to speed up calculations
             static Army tileArmy;
 
-            tileArmy.setFromTile( tile );
+            tileArmy.setFromTile( world.GetTiles( index ) );
 
             return tileArmy.GetStrength() * advantage > armyStrength;
         }
@@ -211,6 +210,159 @@ namespace
     }
 }
 
+void PathfindingTileData::reset( const std::vector<Maps::Tiles> & tiles, const int32_t mapWidth )
+{
+    const size_t tileCount = tiles.size();
+
+    _objectType.resize( tileCount );
+    _passable.resize( tileCount );
+    _flags.resize( tileCount );
+    _fogColors.resize( tileCount );
+    _groundPenalty.resize( tileCount * skillLevelCount );
+    _monsterProtection.resize( tileCount );
+
+    _mapWidth = mapWidth;
+    _mapHeight = mapWidth > 0 ? static_cast<int32_t>( tileCount ) / mapWidth : 0;
+
+    for ( const Maps::Tiles & tile : tiles ) {
+        setTileProperties( tile );
+    }
+
+    // Protection depends on properties of neighbouring tiles so it is calculated once all properties are set.
+    for ( int32_t index = 0; index < static_cast<int32_t>( tileCount ); ++index ) {
+        _monsterProtection[index] = calculateMonsterProtection( index );
+    }
+}
+
+void PathfindingTileData::clear()
+{
+    _objectType.clear();
+    _passable.clear();
+    _flags.clear();
+    _fogColors.clear();
+    _groundPenalty.clear();
+    _monsterProtection.clear();
+
+    _mapWidth = 0;
+    _mapHeight = 0;
+}
+
+void PathfindingTileData::update( const Maps::Tiles & tile )
+{
+    const int32_t index = tile.GetIndex();
+
+    // Tiles are being modified while the map is loading. All data is set once the loading is complete.
+    if ( index < 0 || static_cast<size_t>( index ) >= _objectType.size() ) {
+        return;
+    }
+
+    setTileProperties( tile );
+
+    // Changes of the tile affect protection of the tile itself and of all tiles around it.
+    const int32_t x = index % _mapWidth;
+    const int32_t y = index / _mapWidth;
+
+    for ( int32_t neighbourY = std::max( y - 1, 0 ); neighbourY <= std::min( y + 1, _mapHeight - 1 ); ++neighbourY ) {
+        for ( int32_t neighbourX = std::max( x - 1, 0 ); neighbourX <= std::min( x + 1, _mapWidth - 1 ); ++neighbourX ) {
+            const int32_t neighbourIndex = neighbourY * _mapWidth + neighbourX;
+            _monsterProtection[neighbourIndex] = calculateMonsterProtection( neighbourIndex );
+        }
+    }
+}
+
+void PathfindingTileData::setTileProperties( const Maps::Tiles & tile )
+{
+    const int32_t index = tile.GetIndex();
+
+    _objectType[index] = tile.GetObject();
+    _passable[index] = tile.GetPassable();
+    _flags[index] = ( tile.isWater() ? FLAG_WATER : 0 ) | ( tile.isRoad() ? FLAG_ROAD : 0 );
+    _fogColors[index] = tile.getFogColors();
+
+    for ( int32_t level = 0; level < skillLevelCount; ++level ) {
+        _groundPenalty[index * skillLevelCount + level] = static_cast<uint8_t>( Maps::Ground::GetPenalty( tile, level ) );
+    }
+}
+
+uint16_t PathfindingTileData::calculateMonsterProtection( const int32_t index ) const
+{
+    uint16_t protection = ( _objectType[index] == MP2::OBJ_MONSTER ) ? Direction::CENTER : 0;
+
+    const int32_t x = index % _mapWidth;
+    const int32_t y = index / _mapWidth;
+
+    for ( const int direction : Direction::All() ) {
+        const int32_t neighbourX = x + ( ( direction & DIRECTION_LEFT_COL ) ? -1 : ( ( direction & DIRECTION_RIGHT_COL ) ? 1 : 0 ) );
+        const int32_t neighbourY = y + ( ( direction & DIRECTION_TOP_ROW ) ? -1 : ( ( direction & DIRECTION_BOTTOM_ROW ) ? 1 : 0 ) );
+
+        if ( neighbourX < 0 || neighbourX >= _mapWidth || neighbourY < 0 || neighbourY >= _mapHeight ) {
+            continue;
+        }
+
+        if ( isTileUnderMonsterProtection( index, neighbourY * _mapWidth + neighbourX, direction ) ) {
+            protection |= direction;
+        }
+    }
+
+    return protection;
+}
+
+bool PathfindingTileData::isTileUnderMonsterProtection( const int32_t index, const int32_t monsterIndex, const int directionToMonster ) const
+{
+    // A pickupable object can be accessed without triggering a monster attack
+    if ( MP2::isPickupObject( _objectType[index] ) || _objectType[monsterIndex] != MP2::OBJ_MONSTER || isWater( index ) != isWater( monsterIndex ) ) {
+        return false;
+    }
+
+    const int directionFromMonster = Direction::Reflect( directionToMonster );
+    const uint16_t passable = _passable[index];
+    const uint16_t monsterPassable = _passable[monsterIndex];
+
+    // The tile is directly accessible to the monster
+    if ( ( passable & directionToMonster ) && ( monsterPassable & directionFromMonster ) ) {
+        return true;
+    }
+
+    // The tile is not directly accessible to the monster, but he can still attack in the diagonal direction if, when the hero moves away from the tile
+    // in question in the vertical direction and the monster moves away from his tile in the horizontal direction, they would have to meet
+    if ( directionFromMonster == Direction::TOP_LEFT && ( passable & Direction::BOTTOM ) && ( monsterPassable & Direction::LEFT ) ) {
+        return true;
+    }
+    if ( directionFromMonster == Direction::TOP_RIGHT && ( passable & Direction::BOTTOM ) && ( monsterPassable & Direction::RIGHT ) ) {
+        return true;
+    }
+    if ( directionFromMonster == Direction::BOTTOM_RIGHT && ( passable & Direction::TOP ) && ( monsterPassable & Direction::RIGHT ) ) {
+        return true;
+    }
+    if ( directionFromMonster == Direction::BOTTOM_LEFT && ( passable & Direction::TOP ) && ( monsterPassable & Direction::LEFT ) ) {
+        return true;
+    }
+
+    return false;
+}
+
+bool PathfindingTileData::isPassableFrom( const int32_t index, const int direction, const bool fromWater, const int heroColor ) const
+{
+    if ( isFog( index, heroColor ) ) {
+        return false;
+    }
+
+    const bool tileIsWater = isWater( index );
+    const MP2::MapObjectType objectType = _objectType[index];
+
+    // From the water we can get either to the coast tile or to the water tile (provided there is no boat on this tile).
+    if ( fromWater && objectType != MP2::OBJ_COAST && ( !tileIsWater || objectType == MP2::OBJ_BOAT ) ) {
+        return false;
+    }
+
+    // From the ground we can get to the water tile only if this tile contains a certain object.
+    if ( !fromWater && tileIsWater && objectType != MP2::OBJ_SHIPWRECK && objectType != MP2::OBJ_HEROES && objectType != MP2::OBJ_BOAT ) {
+        return false;
+    }
+
+    return ( direction & _passable[index] ) != 0;
+}
+
 void WorldPathfinder::checkWorldSize()
 {
     const size_t worldSize = world.getSize();
@@ -238,10 +390,10 @@ uint32_t WorldPathfinder::calculatePathPenalty( const std::list<Route::Step> & p
 
 uint32_t WorldPathfinder::getMovementPenalty( int src, int dst, int direction ) const
 {
-    const Maps::Tiles & srcTile = world.GetTiles( src );
-    const Maps::Tiles & dstTile = world.GetTiles( dst );
+    const PathfindingTileData & tileData = world.getPathfindingTileData();
+    const bool isSrcRoad = tileData.isRoad( src );
 
-    uint32_t penalty = srcTile.isRoad() && dstTile.isRoad() ? Maps::Ground::roadPenalty : Maps::Ground::GetPenalty( srcTile, _pathfindingSkill );
+    uint32_t penalty = isSrcRoad && tileData.isRoad( dst ) ? Maps::Ground::roadPenalty : tileData.getGroundPenalty( src, _pathfindingSkill );
 
     // Diagonal movement costs 50% more
     if ( Direction::isDiagonal( direction ) ) {
@@ -259,7 +411,7 @@ uint32_t WorldPathfinder::getMovementPenalty( int src, int dst, int direction )
         assert( src == _pathStart || node._from != -1 );
 
         const uint32_t remainingMovePoints = node._remainingMovePoints;
-        const uint32_t srcTilePenalty = srcTile.isRoad() ? Maps::Ground::roadPenalty : Maps::Ground::GetPenalty( srcTile, _pathfindingSkill );
+        const uint32_t srcTilePenalty = isSrcRoad ? Maps::Ground::roadPenalty : tileData.getGroundPenalty( src, _pathfindingSkill );
 
         // If we still have enough movement points to move over the src tile in the straight
         // direction, but not enough to move to the dst tile, then the "last move" logic is
@@ -329,11 +481,9 @@ void WorldPathfinder::checkAdjacentNodes( std::vector<int> & nodesToExplore, int
         WorldNode & newNode = _cache[newIndex];
 
         if ( newNode._from == -1 || newNode._cost > movementCost ) {
-            const Maps::Tiles & newTile = world.GetTiles( newIndex );
-
             newNode._from = currentNodeIdx;
             newNode._cost = movementCost;
-            newNode._objectID = newTile.GetObject();
+            newNode._objectID = world.getPathfindingTileData().getObject( newIndex );
             newNode._remainingMovePoints = substractMovePoints( currentNode._remainingMovePoints, movementPenalty );
 
             nodesToExplore.push_back( newIndex );
@@ -410,32 +560,34 @@ void PlayerWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplor
     const bool isFirstNode = currentNodeIdx == _pathStart;
     const WorldNode & currentNode = _cache[currentNodeIdx];
 
-    if ( !isFirstNode && isTileBlocked( currentNodeIdx, world.GetTiles( _pathStart ).isWater() ) ) {
+    if ( !isFirstNode && isTileBlocked( currentNodeIdx, world.getPathfindingTileData().isWater( _pathStart ) ) ) {
         return;
     }
 
-    const MapsIndexes & monsters = Maps::getMonstersProtectingTile( currentNodeIdx );
+    const uint16_t protectionDirections = Maps::getMonsterProtectionDirections( currentNodeIdx );
 
     // If the current tile is protected, then the hero can only move to one of the neighboring monsters
-    if ( !isFirstNode && !monsters.empty() ) {
-        for ( int monsterIndex : monsters ) {
-            const int direction = Maps::GetDirection( currentNodeIdx, monsterIndex );
+    if ( !isFirstNode && protectionDirections != 0 ) {
+        const Directions & directions = Direction::All();
+
+        for ( size_t i = 0; i < directions.size(); ++i ) {
+            const int direction = directions[i];
 
-            if ( direction == Direction::UNKNOWN || direction == Direction::CENTER || !isValidPath( currentNodeIdx, direction, _currentColor ) ) {
+            if ( ( protectionDirections & direction ) == 0 || !isValidPath( currentNodeIdx, direction, _currentColor ) ) {
                 continue;
             }
 
+            const int monsterIndex = currentNodeIdx + _mapOffset[i];
+
             const uint32_t movementPenalty = getMovementPenalty( currentNodeIdx, monsterIndex, direction );
             const uint32_t movementCost = currentNode._cost + movementPenalty;
 
             WorldNode & monsterNode = _cache[monsterIndex];
 
             if ( monsterNode._from == -1 || monsterNode._cost > movementCost ) {
-                const Maps::Tiles & monsterTile = world.GetTiles( monsterIndex );
-
                 monsterNode._from = currentNodeIdx;
                 monsterNode._cost = movementCost;
-                monsterNode._objectID = monsterTile.GetObject();
+                monsterNode._objectID = world.getPathfindingTileData().getObject( monsterIndex );
                 monsterNode._remainingMovePoints = substractMovePoints( currentNode._remainingMovePoints, movementPenalty );
             }
         }
@@ -459,14 +611,16 @@ void AIWorldPathfinder::reset()
 
         _armyStrength = -1;
         _isArtifactBagFull = false;
+        _maxDistance = 0;
     }
 }
 
 void AIWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
 {
-    auto currentSettings = std::tie( _pathStart, _pathfindingSkill, _currentColor, _remainingMovePoints, _maxMovePoints, _armyStrength, _isArtifactBagFull );
+    auto currentSettings
+        = std::tie( _pathStart, _pathfindingSkill, _currentColor, _remainingMovePoints, _maxMovePoints, _armyStrength, _isArtifactBagFull, _maxDistance );
     const auto newSettings = std::make_tuple( hero.GetIndex(), static_cast<uint8_t>( hero.GetLevelSkill( Skill::Secondary::PATHFINDING ) ), hero.GetColor(),
-                                              hero.GetMovePoints(), hero.GetMaxMovePoints(), hero.GetArmy().GetStrength(), hero.GetBagArtifacts().isFull() );
+                                              hero.GetMovePoints(), hero.GetMaxMovePoints(), hero.GetArmy().GetStrength(), hero.GetBagArtifacts().isFull(), 0U );
 
     if ( currentSettings != newSettings ) {
         currentSettings = newSettings;
@@ -475,10 +629,12 @@ void AIWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
     }
 }
 
-void AIWorldPathfinder::reEvaluateIfNeeded( const int start, const int color, const double armyStrength, const uint8_t skill, const bool isArtifactBagFull )
+void AIWorldPathfinder::reEvaluateIfNeeded( const int start, const int color, const double armyStrength, const uint8_t skill, const bool isArtifactBagFull,
+                                            const uint32_t maxDistance /* = 0 */ )
 {
-    auto currentSettings = std::tie( _pathStart, _pathfindingSkill, _currentColor, _remainingMovePoints, _maxMovePoints, _armyStrength, _isArtifactBagFull );
-    const auto newSettings = std::make_tuple( start, skill, color, 0U, 0U, armyStrength, isArtifactBagFull );
+    auto currentSettings
+        = std::tie( _pathStart, _pathfindingSkill, _currentColor, _remainingMovePoints, _maxMovePoints, _armyStrength, _isArtifactBagFull, _maxDistance );
+    const auto newSettings = std::make_tuple( start, skill, color, 0U, 0U, armyStrength, isArtifactBagFull, maxDistance );
 
     if ( currentSettings != newSettings ) {
         currentSettings = newSettings;
@@ -492,14 +648,24 @@ void AIWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, c
     const bool isFirstNode = currentNodeIdx == _pathStart;
     WorldNode & currentNode = _cache[currentNodeIdx];
 
+    // Movement penalties are never negative so paths through this node cannot be shorter than the maximum distance.
+    if ( _maxDistance > 0 && currentNode._cost > _maxDistance ) {
+        return;
+    }
+
     // Find out if current node is protected by a strong army
     bool isProtected = isTileProtectedForAI( currentNodeIdx, _armyStrength, _advantage );
     if ( !isProtected ) {
-        const MapsIndexes & monsters = Maps::getMonstersProtectingTile( currentNodeIdx );
-        for ( auto it = monsters.begin(); it != monsters.end(); ++it ) {
-            if ( isTileProtectedForAI( *it, _armyStrength, _advantage ) ) {
-                isProtected = true;
-                break;
+        // A monster on the current tile has been checked above.
+        const uint16_t protectionDirections = Maps::getMonsterProtectionDirections( currentNodeIdx ) & DIRECTION_AROUND;
+        if ( protectionDirections != 0 ) {
+            const Directions & directions = Direction::All();
+
+            for ( size_t i = 0; i < directions.size(); ++i ) {
+                if ( ( protectionDirections & directions[i] ) && isTileProtectedForAI( currentNodeIdx + _mapOffset[i], _armyStrength, _advantage ) ) {
+                    isProtected = true;
+                    break;
+                }
             }
         }
     }
@@ -540,11 +706,9 @@ void AIWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, c
 
         // Check if move is actually faster through teleport
         if ( teleportNode._from == -1 || teleportNode._cost > currentNode._cost ) {
-            const Maps::Tiles & teleportTile = world.GetTiles( teleportIdx );
-
             teleportNode._from = currentNodeIdx;
             teleportNode._cost = currentNode._cost;
-            teleportNode._objectID = teleportTile.GetObject();
+            teleportNode._objectID = world.getPathfindingTileData().getObject( teleportIdx );
             teleportNode._remainingMovePoints = currentNode._remainingMovePoints;
 
             nodesToExplore.push_back( teleportIdx );
@@ -564,11 +728,12 @@ uint32_t AIWorldPathfinder::getMovementPenalty( int src, int dst, int direction
         // No dead ends allowed
         assert( src == _pathStart || node._from != -1 );
 
-        const Maps::Tiles & srcTile = world.GetTiles( src );
-        const Maps::Tiles & dstTile = world.GetTiles( dst );
+        const PathfindingTileData & tileData = world.getPathfindingTileData();
+        const bool isSrcWater = tileData.isWater( src );
+        const MP2::MapObjectType dstObjectType = tileData.getObject( dst );
 
         // When the hero gets into a boat or disembarks, he spends all remaining movement points.
-        if ( ( !srcTile.isWater() && dstTile.GetObject() == MP2::OBJ_BOAT ) || ( srcTile.isWater() && dstTile.GetObject() == MP2::OBJ_COAST ) ) {
+        if ( ( !isSrcWater && dstObjectType == MP2::OBJ_BOAT ) || ( isSrcWater && dstObjectType == MP2::OBJ_COAST ) ) {
             // If the hero is not able to make this movement this turn, then he will have to spend
             // all the movement points next turn.
             if ( defaultPenalty > node._remainingMovePoints ) {
@@ -633,7 +798,7 @@ int AIWorldPathfinder::getFogDiscoveryTile( const Heroes & hero )
 
             tilesVisited[newIndex] = true;
 
-            if ( !MP2::isSafeForFogDiscoveryObject( world.GetTiles( newIndex ).GetObject( true ) ) ) {
+            if ( !MP2::isSafeForFogDiscoveryObject( world.getPathfindingTileData().getObject( newIndex ) ) ) {
                 continue;
             }
 
@@ -693,7 +858,7 @@ int AIWorldPathfinder::getNearestTileToMove( const Heroes & hero )
         }
 
         // Don't go onto action objects as they might be castles or dwellings with guards.
-        if ( MP2::isActionObject( world.GetTiles( newIndex ).GetObject( true ) ) ) {
+        if ( MP2::isActionObject( world.getPathfindingTileData().getObject( newIndex ) ) ) {
             continue;
         }
 
@@ -1034,7 +1199,7 @@ std::list<Route::Step> AIWorldPathfinder::buildPath( const int targetIndex, cons
         return path;
     }
 
-    const bool fromWater = world.GetTiles( _pathStart ).isWater();
+    const bool fromWater = world.getPathfindingTileData().isWater( _pathStart );
 
 #ifndef NDEBUG
     std::set<int> uniqPathIndexes;
@@ -1072,9 +1237,9 @@ std::list<Route::Step> AIWorldPathfinder::buildPath( const int targetIndex, cons
     return path;
 }
 
-uint32_t AIWorldPathfinder::getDistance( int start, int targetIndex, int color, double armyStrength, uint8_t skill )
+uint32_t AIWorldPathfinder::getDistance( int start, int targetIndex, int color, double armyStrength, uint8_t skill, const uint32_t maxDistance )
 {
-    reEvaluateIfNeeded( start, color, armyStrength, skill, false );
+    reEvaluateIfNeeded( start, color, armyStrength, skill, false, maxDistance );
 
     return _cache[targetIndex]._cost;
 }
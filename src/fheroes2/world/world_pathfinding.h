@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstdint>
 #include <list>
 #include <vector>
@@ -32,11 +33,102 @@
 class Heroes;
 class IndexObject;
 
+namespace Maps
+{
+    class Tiles;
+}
+
 namespace Route
 {
     class Step;
 }
 
+// Compact copy of tile properties which pathfinders check for every neighbour of every node. Properties are kept in parallel arrays
+// so these checks do not have to touch large Maps::Tiles objects. World updates this data every time the corresponding tile properties change.
+class PathfindingTileData
+{
+public:
+    PathfindingTileData() = default;
+    PathfindingTileData( const PathfindingTileData & ) = delete;
+
+    PathfindingTileData & operator=( const PathfindingTileData & ) = delete;
+
+    void reset( const std::vector<Maps::Tiles> & tiles, const int32_t mapWidth );
+
+    void clear();
+
+    void update( const Maps::Tiles & tile );
+
+    MP2::MapObjectType getObject( const int32_t index ) const
+    {
+        return _objectType[index];
+    }
+
+    uint16_t getPassable( const int32_t index ) const
+    {
+        return _passable[index];
+    }
+
+    bool isWater( const int32_t index ) const
+    {
+        return ( _flags[index] & FLAG_WATER ) != 0;
+    }
+
+    bool isRoad( const int32_t index ) const
+    {
+        return ( _flags[index] & FLAG_ROAD ) != 0;
+    }
+
+    bool isFog( const int32_t index, const int colors ) const
+    {
+        return ( _fogColors[index] & colors ) == colors;
+    }
+
+    // Returns the movement penalty of the tile ground (roads are not taken into account) for the given level of Pathfinding skill.
+    uint32_t getGroundPenalty( const int32_t index, const uint8_t pathfindingSkill ) const
+    {
+        assert( pathfindingSkill < skillLevelCount );
+
+        return _groundPenalty[index * skillLevelCount + pathfindingSkill];
+    }
+
+    // Returns a bitmask of directions (see Direction namespace) to adjacent tiles with monsters protecting this tile.
+    // Direction::CENTER is set if the tile itself contains a monster.
+    uint16_t getMonsterProtection( const int32_t index ) const
+    {
+        return _monsterProtection[index];
+    }
+
+    // Same as Maps::Tiles::isPassableFrom() with fog taken into account.
+    bool isPassableFrom( const int32_t index, const int direction, const bool fromWater, const int heroColor ) const;
+
+private:
+    void setTileProperties( const Maps::Tiles & tile );
+
+    uint16_t calculateMonsterProtection( const int32_t index ) const;
+
+    bool isTileUnderMonsterProtection( const int32_t index, const int32_t monsterIndex, const int directionToMonster ) const;
+
+    enum : uint8_t
+    {
+        FLAG_WATER = 0x01,
+        FLAG_ROAD = 0x02
+    };
+
+    // Pathfinding skill levels from Skill::Level::NONE to Skill::Level::EXPERT.
+    static constexpr int32_t skillLevelCount = 4;
+
+    std::vector<MP2::MapObjectType> _objectType;
+    std::vector<uint16_t> _passable;
+    std::vector<uint8_t> _flags;
+    std::vector<uint8_t> _fogColors;
+    std::vector<uint8_t> _groundPenalty;
+    std::vector<uint16_t> _monsterProtection;
+
+    int32_t _mapWidth{ 0 };
+    int32_t _mapHeight{ 0 };
+};
+
 struct WorldNode : public PathfindingNode<MP2::MapObjectType>
 {
     // The number of movement points remaining for the hero after moving to this node
@@ -132,7 +224,10 @@ public:
     void reset() override;
 
     void reEvaluateIfNeeded( const Heroes & hero );
-    void reEvaluateIfNeeded( const int start, const int color, const double armyStrength, const uint8_t skill, const bool isArtifactBagFull );
+    // If the maximum distance is set, tiles which are further than this distance are not explored. Distances to such tiles are either unknown (0)
+    // or larger than the maximum distance but not necessarily the shortest ones.
+    void reEvaluateIfNeeded( const int start, const int color, const double armyStrength, const uint8_t skill, const bool isArtifactBagFull,
+                             const uint32_t maxDistance = 0 );
     int getFogDiscoveryTile( const Heroes & hero );
 
     // Used for cases when heroes are stuck because one hero might be blocking the way and we have to move him.
@@ -144,8 +239,9 @@ public:
 
     std::list<Route::Step> getDimensionDoorPath( const Heroes & hero, int targetIndex ) const;
 
-    // Used for non-hero armies, like castles or monsters
-    uint32_t getDistance( int start, int targetIndex, int color, double armyStrength, uint8_t skill = Skill::Level::EXPERT );
+    // Used for non-hero armies, like castles or monsters. If only targets within some distance are of interest, the maximum distance
+    // limits the search to the area around the starting tile. Returned distances which are larger than the maximum distance are not exact.
+    uint32_t getDistance( int start, int targetIndex, int color, double armyStrength, uint8_t skill = Skill::Level::EXPERT, const uint32_t maxDistance = 0 );
 
     // Override builds path to the nearest valid object
     std::list<Route::Step> buildPath( const int targetIndex, const bool isPlanningMode = false ) const;
@@ -175,4 +271,5 @@ private:
     double _advantage{ 1.0 };
     double _spellPointsReserved{ 0.5 };
     bool _isArtifactBagFull{ false };
+    uint32_t _maxDistance{ 0 };
 };
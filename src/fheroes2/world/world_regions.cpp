@@ -19,10 +19,13 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <system_error>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -60,9 +63,9 @@ namespace
         return 1 << ( reflect ? ( direction + 4 ) % 8 : direction );
     }
 
-    std::vector<int> GetDirectionOffsets( const int width )
+    std::array<int, 8> GetDirectionOffsets( const int width )
     {
-        std::vector<int> offsets( 8 );
+        std::array<int, 8> offsets{};
         offsets[TOP_LEFT] = -width - 1;
         offsets[TOP] = -width;
         offsets[TOP_RIGHT] = -width + 1;
@@ -92,51 +95,95 @@ namespace
         return true;
     }
 
-    void CheckAdjacentTiles( std::vector<MapRegionNode> & rawData, MapRegion & region, uint32_t rawDataWidth, const std::vector<int> & offsets )
+    // Calls the function for ranges [startY, endY) of map rows. Rows of big maps are split between several threads.
+    template <typename Function>
+    void ProcessRowsInParallel( const int height, const Function & function )
     {
-        const int nodeIndex = region._nodes[region._lastProcessedNode].index;
+        // Starting a thread costs more than processing a few rows.
+        const int minRowsPerThread = 32;
+
+        const int threadCount = std::clamp( static_cast<int>( std::thread::hardware_concurrency() ), 1, std::max( 1, height / minRowsPerThread ) );
+        if ( threadCount == 1 ) {
+            function( 0, height );
+            return;
+        }
+
+        const int rowsPerThread = ( height + threadCount - 1 ) / threadCount;
+
+        std::vector<std::thread> workers;
+        workers.reserve( threadCount - 1 );
+
+        int startY = rowsPerThread;
+        for ( ; startY < height; startY += rowsPerThread ) {
+            const int endY = std::min( startY + rowsPerThread, height );
+
+            try {
+                workers.emplace_back( [&function, startY, endY]() { function( startY, endY ); } );
+            }
+            catch ( const std::system_error & ) {
+                // The thread cannot be started. The remaining rows are processed by the calling thread.
+                break;
+            }
+        }
+
+        function( 0, rowsPerThread );
+
+        if ( startY < height ) {
+            function( startY, height );
+        }
+
+        for ( std::thread & worker : workers ) {
+            worker.join();
+        }
+    }
+
+    void CheckAdjacentTiles( std::vector<MapRegionNode> & rawData, MapRegion & region, const std::array<int, 8> & offsets )
+    {
+        const int nodeIndex = region._nodes[region._lastProcessedNode];
 
         for ( uint8_t direction = 0; direction < 8; ++direction ) {
-            const int newIndex = ConvertExtendedIndex( nodeIndex, rawDataWidth ) + offsets[direction];
+            const int newIndex = nodeIndex + offsets[direction];
             MapRegionNode & newTile = rawData[newIndex];
             if ( newTile.passable & GetDirectionBitmask( direction, true ) && newTile.isWater == region._isWater ) {
                 if ( newTile.type == REGION_NODE_OPEN ) {
                     newTile.type = region._id;
-                    region._nodes.push_back( newTile );
+                    region._nodes.push_back( newIndex );
                 }
                 else if ( newTile.type > REGION_NODE_FOUND && newTile.type != region._id ) {
-                    region._neighbours.insert( newTile.type );
+                    // Duplicates are removed once all regions are built.
+                    if ( region._neighbours.empty() || region._neighbours.back() != newTile.type ) {
+                        region._neighbours.push_back( newTile.type );
+                    }
                 }
             }
         }
     }
 
-    void RegionExpansion( std::vector<MapRegionNode> & rawData, uint32_t rawDataWidth, MapRegion & region, const std::vector<int> & offsets )
+    void RegionExpansion( std::vector<MapRegionNode> & rawData, MapRegion & region, const std::array<int, 8> & offsets )
     {
         // Process only "open" nodes that exist at the start of the loop and ignore what's added
         const size_t nodesEnd = region._nodes.size();
 
         while ( region._lastProcessedNode < nodesEnd ) {
-            CheckAdjacentTiles( rawData, region, rawDataWidth, offsets );
+            CheckAdjacentTiles( rawData, region, offsets );
             ++region._lastProcessedNode;
         }
     }
 
     void FindMissingRegions( std::vector<MapRegionNode> & rawData, const fheroes2::Size & mapSize, std::vector<MapRegion> & regions )
     {
-        const uint32_t extendedWidth = mapSize.width + 2;
+        const int extendedWidth = mapSize.width + 2;
+        const int mapEnd = extendedWidth * ( mapSize.height + 1 );
+        const std::array<int, 8> offsets = GetDirectionOffsets( extendedWidth );
 
-        MapRegionNode * currentTile = rawData.data() + extendedWidth + 1;
-        const MapRegionNode * mapEnd = rawData.data() + extendedWidth * ( mapSize.height + 1 );
-        const std::vector<int> & offsets = GetDirectionOffsets( static_cast<int>( extendedWidth ) );
-
-        for ( ; currentTile != mapEnd; ++currentTile ) {
-            if ( currentTile->type == REGION_NODE_OPEN ) {
-                regions.emplace_back( static_cast<int>( regions.size() ), currentTile->index, currentTile->isWater, extendedWidth );
+        for ( int nodeIndex = extendedWidth + 1; nodeIndex != mapEnd; ++nodeIndex ) {
+            const MapRegionNode & node = rawData[nodeIndex];
+            if ( node.type == REGION_NODE_OPEN ) {
+                regions.emplace_back( static_cast<int>( regions.size() ), nodeIndex, node.isWater, extendedWidth );
 
                 MapRegion & region = regions.back();
                 do {
-                    CheckAdjacentTiles( rawData, region, extendedWidth, offsets );
+                    CheckAdjacentTiles( rawData, region, offsets );
                     ++region._lastProcessedNode;
                 } while ( region._lastProcessedNode != region._nodes.size() );
             }
@@ -144,13 +191,12 @@ namespace
     }
 }
 
-MapRegion::MapRegion( int regionIndex, int mapIndex, bool water, size_t expectedSize )
+MapRegion::MapRegion( int regionIndex, int extendedIndex, bool water, size_t expectedSize )
     : _id( regionIndex )
     , _isWater( water )
 {
     _nodes.reserve( expectedSize );
-    _nodes.emplace_back( mapIndex );
-    _nodes[0].type = regionIndex;
+    _nodes.push_back( extendedIndex );
 }
 
 size_t MapRegion::getNeighboursCount() const
@@ -200,31 +246,49 @@ void World::ComputeStaticAnalysis()
         obstacles[3].emplace_back( y, 0 ); // ground, rows
     }
 
-    // Find the terrain
-    for ( int y = 0; y < height; ++y ) {
-        const int rowIndex = y * width;
-        for ( int x = 0; x < width; ++x ) {
-            const int index = rowIndex + x;
-            const Maps::Tiles & tile = vec_tiles[index];
-            // If tile is blocked (mountain, trees, etc) then it's applied to both
-            if ( tile.GetPassable() == 0 ) {
-                ++obstacles[0][x].second;
-                ++obstacles[1][y].second;
-                ++obstacles[2][x].second;
-                ++obstacles[3][y].second;
-            }
-            else if ( tile.isWater() ) {
-                // if it's water then ground tiles consider it an obstacle
-                ++obstacles[2][x].second;
-                ++obstacles[3][y].second;
-            }
-            else {
-                // else then ground is an obstacle for water navigation
-                ++obstacles[0][x].second;
-                ++obstacles[1][y].second;
+    // Find the terrain. Rows are counted independently, columns are summed up from counters of every range of rows.
+    std::mutex columnMutex;
+    ProcessRowsInParallel( height, [this, &obstacles, &columnMutex]( const int startY, const int endY ) {
+        std::vector<int> waterColumns( width, 0 );
+        std::vector<int> groundColumns( width, 0 );
+
+        for ( int y = startY; y < endY; ++y ) {
+            const int rowIndex = y * width;
+            int waterRow = 0;
+            int groundRow = 0;
+
+            for ( int x = 0; x < width; ++x ) {
+                const Maps::Tiles & tile = vec_tiles[rowIndex + x];
+                // If tile is blocked (mountain, trees, etc) then it's applied to both
+                if ( tile.GetPassable() == 0 ) {
+                    ++waterColumns[x];
+                    ++waterRow;
+                    ++groundColumns[x];
+                    ++groundRow;
+                }
+                else if ( tile.isWater() ) {
+                    // if it's water then ground tiles consider it an obstacle
+                    ++groundColumns[x];
+                    ++groundRow;
+                }
+                else {
+                    // else then ground is an obstacle for water navigation
+                    ++waterColumns[x];
+                    ++waterRow;
+                }
             }
+
+            obstacles[1][y].second = waterRow;
+            obstacles[3][y].second = groundRow;
         }
-    }
+
+        const std::lock_guard<std::mutex> lock( columnMutex );
+
+        for ( int x = 0; x < width; ++x ) {
+            obstacles[0][x].second += waterColumns[x];
+            obstacles[2][x].second += groundColumns[x];
+        }
+    } );
 
     // sort the map rows and columns based on amount of obstacles
     for ( int i = 0; i < 4; ++i )
@@ -263,7 +327,7 @@ void World::ComputeStaticAnalysis()
     }
 
     // Step 4. Add missing region centres based on distance (for water or if there's big chunks of space without castles)
-    const std::vector<int> & directionOffsets = GetDirectionOffsets( width );
+    const std::array<int, 8> directionOffsets = GetDirectionOffsets( width );
     for ( int waterOrGround = 0; waterOrGround < 4; waterOrGround += 2 ) {
         for ( const int rowID : emptyLines[waterOrGround] ) {
             const int rowIndex = rowID * width;
@@ -298,24 +362,27 @@ void World::ComputeStaticAnalysis()
     // Step 5. Initialize extended (by 2 tiles) map data used for region growing based on actual Maps::Tiles
     const uint32_t extendedWidth = width + 2;
     std::vector<MapRegionNode> data( extendedWidth * ( height + 2 ) );
-    for ( int y = 0; y < height; ++y ) {
-        const int rowIndex = y * width;
-        for ( int x = 0; x < width; ++x ) {
-            const int index = rowIndex + x;
-            const Maps::Tiles & tile = vec_tiles[index];
-            MapRegionNode & node = data[ConvertExtendedIndex( index, extendedWidth )];
-
-            node.index = index;
-            node.passable = tile.GetPassable();
-            node.isWater = tile.isWater();
-
-            const MP2::MapObjectType objectType = tile.GetObject();
-            node.mapObject = MP2::isActionObject( objectType, node.isWater ) ? objectType : 0;
-            if ( node.passable != 0 ) {
-                node.type = REGION_NODE_OPEN;
+    ProcessRowsInParallel( height, [this, &data, extendedWidth]( const int startY, const int endY ) {
+        for ( int y = startY; y < endY; ++y ) {
+            const int rowIndex = y * width;
+            MapRegionNode * node = data.data() + ConvertExtendedIndex( rowIndex, extendedWidth );
+
+            for ( int x = 0; x < width; ++x, ++node ) {
+                const int index = rowIndex + x;
+                const Maps::Tiles & tile = vec_tiles[index];
+
+                node->index = index;
+                node->passable = tile.GetPassable();
+                node->isWater = tile.isWater();
+
+                const MP2::MapObjectType objectType = tile.GetObject();
+                node->mapObject = MP2::isActionObject( objectType, node->isWater ) ? objectType : 0;
+                if ( node->passable != 0 ) {
+                    node->type = REGION_NODE_OPEN;
+                }
             }
         }
-    }
+    } );
 
     // Step 6. Initialize regions
     size_t averageRegionSize = ( static_cast<size_t>( width ) * height * 2 ) / regionCenters.size();
@@ -326,21 +393,27 @@ void World::ComputeStaticAnalysis()
 
     for ( const int tileIndex : regionCenters ) {
         const int regionID = static_cast<int>( _regions.size() ); // Safe to do as we can't have so many regions
-        _regions.emplace_back( regionID, tileIndex, vec_tiles[tileIndex].isWater(), averageRegionSize );
-        data[ConvertExtendedIndex( tileIndex, extendedWidth )].type = regionID;
+        const int extendedIndex = ConvertExtendedIndex( tileIndex, extendedWidth );
+        _regions.emplace_back( regionID, extendedIndex, vec_tiles[tileIndex].isWater(), averageRegionSize );
+        data[extendedIndex].type = regionID;
     }
 
-    // Step 7. Grow all regions one step at the time so they would compete for space
-    const std::vector<int> & offsets = GetDirectionOffsets( static_cast<int>( extendedWidth ) );
-    bool stillRoomToExpand = true;
-    while ( stillRoomToExpand ) {
-        stillRoomToExpand = false;
-        for ( size_t regionID = REGION_NODE_FOUND; regionID < regionCenters.size(); ++regionID ) {
-            MapRegion & region = _regions[regionID];
-            RegionExpansion( data, extendedWidth, region, offsets );
-            if ( region._lastProcessedNode != region._nodes.size() )
-                stillRoomToExpand = true;
+    // Step 7. Grow all regions one step at the time so they would compete for space.
+    // Every region has its own frontier: nodes added since the previous step. Regions without a frontier are not visited anymore.
+    const std::array<int, 8> offsets = GetDirectionOffsets( static_cast<int>( extendedWidth ) );
+    std::vector<MapRegion *> growingRegions;
+    for ( size_t regionID = REGION_NODE_FOUND; regionID < regionCenters.size(); ++regionID ) {
+        growingRegions.push_back( &_regions[regionID] );
+    }
+
+    while ( !growingRegions.empty() ) {
+        for ( MapRegion * region : growingRegions ) {
+            RegionExpansion( data, *region, offsets );
         }
+
+        growingRegions.erase( std::remove_if( growingRegions.begin(), growingRegions.end(),
+                                              []( const MapRegion * region ) { return region->_lastProcessedNode == region->_nodes.size(); } ),
+                              growingRegions.end() );
     }
 
     // Step 8. Fill missing data (if there's a small island/lake or unreachable terrain)
@@ -351,8 +424,14 @@ void World::ComputeStaticAnalysis()
         if ( reg._id < REGION_NODE_FOUND )
             continue;
 
-        for ( const MapRegionNode & node : reg._nodes ) {
-            vec_tiles[node.index].UpdateRegion( node.type );
+        for ( size_t nodeId = 0; nodeId < reg._nodes.size(); ++nodeId ) {
+            const MapRegionNode & node = data[reg._nodes[nodeId]];
+            vec_tiles[node.index].UpdateRegion( reg._id );
+
+            // The first node is the region center and it has never been used to connect regions.
+            if ( nodeId == 0 ) {
+                continue;
+            }
 
             // connect regions through teleports
             MapsIndexes exits;
@@ -365,14 +444,19 @@ void World::ComputeStaticAnalysis()
             }
 
             for ( const int exitIndex : exits ) {
-                // neighbours is a set that will force the uniqness
-                reg._neighbours.insert( vec_tiles[exitIndex].GetRegion() );
+                reg._neighbours.push_back( vec_tiles[exitIndex].GetRegion() );
             }
         }
 
-        // Fix missing references
-        for ( uint32_t adjacent : reg._neighbours ) {
-            _regions[adjacent]._neighbours.insert( reg._id );
+        // Fix missing references. The list can grow during the loop if a region is connected to itself.
+        const size_t neighboursCount = reg._neighbours.size();
+        for ( size_t i = 0; i < neighboursCount; ++i ) {
+            _regions[reg._neighbours[i]]._neighbours.push_back( reg._id );
         }
     }
+
+    for ( MapRegion & reg : _regions ) {
+        std::sort( reg._neighbours.begin(), reg._neighbours.end() );
+        reg._neighbours.erase( std::unique( reg._neighbours.begin(), reg._neighbours.end() ), reg._neighbours.end() );
+    }
 }
@@ -22,7 +22,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <set>
 #include <vector>
 
 enum
@@ -40,12 +39,6 @@ struct MapRegionNode
     uint16_t mapObject = 0;
     uint16_t passable = 0;
     bool isWater = false;
-
-    MapRegionNode() = default;
-    explicit MapRegionNode( int index_ )
-        : index( index_ )
-        , type( REGION_NODE_OPEN )
-    {}
 };
 
 struct MapRegion
@@ -53,13 +46,15 @@ struct MapRegion
 public:
     uint32_t _id = REGION_NODE_FOUND;
     bool _isWater = false;
-    std::set<uint32_t> _neighbours;
-    std::vector<MapRegionNode> _nodes;
+    // Sorted IDs of adjacent regions, each ID is present only once.
+    std::vector<uint32_t> _neighbours;
+    // Indexes of region nodes in the extended (by 2 tiles) map grid used for region growing.
+    std::vector<int> _nodes;
     size_t _lastProcessedNode = 0;
 
     MapRegion() = default;
 
-    MapRegion( int regionIndex, int mapIndex, bool water, size_t expectedSize );
+    MapRegion( int regionIndex, int extendedIndex, bool water, size_t expectedSize );
 
     size_t getNeighboursCount() const;
 };